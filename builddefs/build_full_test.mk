@@ -35,3 +35,13 @@ $(TEST_OUTPUT)_DEFS := $(OPT_DEFS) "-DKEYMAP_C=\"keymap.c\""
 $(TEST_OUTPUT)_CONFIG := $(TEST_PATH)/config.h
 
 VPATH += $(TOP_DIR)/tests/test_common
+
+ifeq ($(strip $(SPLIT_KEYBOARD)), yes)
+# Both halves run their own copy of the ChibiOS serial protocol over the simulated link
+$(TEST_OUTPUT)_SRC += \
+	tests/test_common/split_simulator.c \
+	tests/test_common/split_serial_master.c \
+	tests/test_common/split_serial_slave.c
+
+VPATH += $(PLATFORM_PATH)/chibios/drivers
+endif
@@ -630,6 +630,7 @@ ifeq ($(strip $(VIA_ENABLE)), yes)
     RAW_ENABLE := yes
     BOOTMAGIC_ENABLE := yes
     TRI_LAYER_ENABLE := yes
+    CRC_ENABLE := yes
 endif
 
 VALID_CUSTOM_MATRIX_TYPES:= yes lite no
@@ -650,6 +651,38 @@ ifneq ($(strip $(CUSTOM_MATRIX)), yes)
     endif
 endif
 
+VALID_MATRIX_EXPANDER_DRIVER_TYPES := mcp23018 pca9555 shift_register
+MATRIX_EXPANDER_DRIVER ?= none
+ifneq ($(strip $(MATRIX_EXPANDER_DRIVER)), none)
+    ifeq ($(filter $(MATRIX_EXPANDER_DRIVER),$(VALID_MATRIX_EXPANDER_DRIVER_TYPES)),)
+        $(call CATASTROPHIC_ERROR,Invalid MATRIX_EXPANDER_DRIVER,MATRIX_EXPANDER_DRIVER="$(MATRIX_EXPANDER_DRIVER)" is not a valid matrix expander driver)
+    endif
+    ifneq ($(strip $(CUSTOM_MATRIX)), lite)
+        $(call CATASTROPHIC_ERROR,Invalid CUSTOM_MATRIX,MATRIX_EXPANDER_DRIVER requires CUSTOM_MATRIX = lite)
+    endif
+
+    QUANTUM_SRC += $(QUANTUM_DIR)/matrix_expander.c
+
+    ifeq ($(strip $(MATRIX_EXPANDER_DRIVER)), mcp23018)
+        OPT_DEFS += -DMATRIX_EXPANDER_MCP23018
+        I2C_DRIVER_REQUIRED = yes
+        COMMON_VPATH += $(DRIVER_PATH)/gpio
+        SRC += mcp23018.c
+    endif
+
+    ifeq ($(strip $(MATRIX_EXPANDER_DRIVER)), pca9555)
+        OPT_DEFS += -DMATRIX_EXPANDER_PCA9555
+        I2C_DRIVER_REQUIRED = yes
+        COMMON_VPATH += $(DRIVER_PATH)/gpio
+        SRC += pca9555.c
+    endif
+
+    ifeq ($(strip $(MATRIX_EXPANDER_DRIVER)), shift_register)
+        OPT_DEFS += -DMATRIX_EXPANDER_SHIFT_REGISTER
+        SPI_DRIVER_REQUIRED = yes
+    endif
+endif
+
 # Debounce Modules. Set DEBOUNCE_TYPE=custom if including one manually.
 DEBOUNCE_TYPE ?= sym_defer_g
 ifneq ($(strip $(DEBOUNCE_TYPE)), custom)
@@ -49,11 +49,35 @@ void eeprom_write_dword(uint32_t *addr, uint32_t value) {
     eeprom_write_block(&value, addr, 4);
 }
 
+#ifndef EEPROM_UPDATE_BLOCK_CHUNK_SIZE
+#    define EEPROM_UPDATE_BLOCK_CHUNK_SIZE 32
+#endif
+
 void eeprom_update_block(const void *buf, void *addr, size_t len) {
-    uint8_t read_buf[len];
-    eeprom_read_block(read_buf, addr, len);
-    if (memcmp(buf, read_buf, len) != 0) {
-        eeprom_write_block(buf, addr, len);
+    const uint8_t *src = buf;
+    uint8_t       *dst = addr;
+    uint8_t        read_buf[EEPROM_UPDATE_BLOCK_CHUNK_SIZE];
+
+    // Compare a chunk at a time, and only write back the span that actually differs
+    while (len > 0) {
+        size_t chunk = len < sizeof(read_buf) ? len : sizeof(read_buf);
+        eeprom_read_block(read_buf, dst, chunk);
+
+        size_t first = 0;
+        while (first < chunk && read_buf[first] == src[first]) {
+            first++;
+        }
+        if (first < chunk) {
+            size_t last = chunk - 1;
+            while (read_buf[last] == src[last]) {
+                last--;
+            }
+            eeprom_write_block(src + first, dst + first, last - first + 1);
+        }
+
+        src += chunk;
+        dst += chunk;
+        len -= chunk;
     }
 }
 
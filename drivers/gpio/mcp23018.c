@@ -10,12 +10,16 @@
 #define TIMEOUT 100
 
 enum {
-    CMD_IODIRA = 0x00, // i/o direction register
-    CMD_IODIRB = 0x01,
-    CMD_GPPUA  = 0x0C, // GPIO pull-up resistor register
-    CMD_GPPUB  = 0x0D,
-    CMD_GPIOA  = 0x12, // general purpose i/o port register (write modifies OLAT)
-    CMD_GPIOB  = 0x13,
+    CMD_IODIRA   = 0x00, // i/o direction register
+    CMD_IODIRB   = 0x01,
+    CMD_GPINTENA = 0x04, // interrupt-on-change enable register
+    CMD_GPINTENB = 0x05,
+    CMD_INTCONA  = 0x08, // interrupt-on-change control register
+    CMD_INTCONB  = 0x09,
+    CMD_GPPUA    = 0x0C, // GPIO pull-up resistor register
+    CMD_GPPUB    = 0x0D,
+    CMD_GPIOA    = 0x12, // general purpose i/o port register (write modifies OLAT)
+    CMD_GPIOB    = 0x13,
 };
 
 void mcp23018_init(uint8_t addr) {
@@ -74,6 +78,27 @@ bool mcp23018_set_output_all(uint8_t slave_addr, uint8_t confA, uint8_t confB) {
     return true;
 }
 
+bool mcp23018_set_interrupt(uint8_t slave_addr, mcp23018_port_t port, uint8_t mask) {
+    uint8_t addr       = SLAVE_TO_ADDR(slave_addr);
+    uint8_t cmdControl = port ? CMD_INTCONB : CMD_INTCONA;
+    uint8_t cmdEnable  = port ? CMD_GPINTENB : CMD_GPINTENA;
+    uint8_t control    = 0; // compare against the previous pin value
+
+    i2c_status_t ret = i2c_write_register(addr, cmdControl, &control, sizeof(control), TIMEOUT);
+    if (ret != I2C_STATUS_SUCCESS) {
+        dprintf("mcp23018_set_interrupt::controlFAILED::%u\n", ret);
+        return false;
+    }
+
+    ret = i2c_write_register(addr, cmdEnable, &mask, sizeof(mask), TIMEOUT);
+    if (ret != I2C_STATUS_SUCCESS) {
+        dprintf("mcp23018_set_interrupt::enableFAILED::%u\n", ret);
+        return false;
+    }
+
+    return true;
+}
+
 bool mcp23018_read_pins(uint8_t slave_addr, mcp23018_port_t port, uint8_t* out) {
     uint8_t addr = SLAVE_TO_ADDR(slave_addr);
     uint8_t cmd  = port ? CMD_GPIOB : CMD_GPIOA;
@@ -52,6 +52,13 @@ bool mcp23018_set_output(uint8_t slave_addr, mcp23018_port_t port, uint8_t conf)
  */
 bool mcp23018_set_output_all(uint8_t slave_addr, uint8_t confA, uint8_t confB);
 
+/**
+ * Enable interrupt-on-change for the pins of a given port
+ *
+ *  - INTA/INTB assert (active low) when a pin in the mask changes, and clear once the port is read
+ */
+bool mcp23018_set_interrupt(uint8_t slave_addr, mcp23018_port_t port, uint8_t mask);
+
 /**
  * Read state of a given port
  */
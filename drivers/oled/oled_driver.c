@@ -23,6 +23,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #        include "keyboard.h"
 #    endif
 #endif
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_OLED_BUFFER_ENABLE)
+#    include "keyboard.h"
+#endif
 #include "oled_driver.h"
 #include OLED_FONT_H
 #include "timer.h"
@@ -30,6 +33,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include <string.h>
 #include "progmem.h"
 #include "wait.h"
+#include "util.h"
 
 // Used commands from spec sheet: https://cdn-shop.adafruit.com/datasheets/SSD1306.pdf
 // for SH1106: https://www.velleman.eu/downloads/29/infosheets/sh1106_datasheet.pdf
@@ -143,7 +147,13 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 // this is so we don't end up with rounding errors with
 // parts of the display unusable or don't get cleared correctly
 // and also allows for drawing & inverting
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_OLED_BUFFER_ENABLE)
+// Swapped with oled_remote_buffer while the master draws the slave's display
+static uint8_t  oled_local_framebuffer[OLED_MATRIX_SIZE];
+uint8_t *       oled_buffer = oled_local_framebuffer;
+#else
 uint8_t         oled_buffer[OLED_MATRIX_SIZE];
+#endif
 uint8_t *       oled_cursor;
 OLED_BLOCK_TYPE oled_dirty          = 0;
 bool            oled_initialized    = false;
@@ -204,6 +214,9 @@ __attribute__((weak)) bool oled_send_cmd(const uint8_t *data, uint16_t size) {
     i2c_status_t status = i2c_transmit((OLED_DISPLAY_ADDRESS << 1), data, size, OLED_I2C_TIMEOUT);
 
     return (status == I2C_STATUS_SUCCESS);
+#else
+    // Custom transports provide their own
+    return false;
 #endif
 }
 
@@ -227,6 +240,9 @@ __attribute__((weak)) bool oled_send_cmd_P(const uint8_t *data, uint16_t size) {
     i2c_status_t status = i2c_transmit_P((OLED_DISPLAY_ADDRESS << 1), data, size, OLED_I2C_TIMEOUT);
 
     return (status == I2C_STATUS_SUCCESS);
+#    else
+    // Custom transports provide their own
+    return false;
 #    endif
 #else
     return oled_send_cmd(data, size);
@@ -250,6 +266,9 @@ __attribute__((weak)) bool oled_send_data(const uint8_t *data, uint16_t size) {
 #elif defined(OLED_TRANSPORT_I2C)
     i2c_status_t status = i2c_write_register((OLED_DISPLAY_ADDRESS << 1), I2C_DATA, data, size, OLED_I2C_TIMEOUT);
     return (status == I2C_STATUS_SUCCESS);
+#else
+    // Custom transports provide their own
+    return false;
 #endif
 }
 
@@ -377,7 +396,7 @@ __attribute__((weak)) oled_rotation_t oled_init_user(oled_rotation_t rotation) {
 }
 
 void oled_clear(void) {
-    memset(oled_buffer, 0, sizeof(oled_buffer));
+    memset(oled_buffer, 0, OLED_MATRIX_SIZE);
     oled_cursor = &oled_buffer[0];
     oled_dirty  = OLED_ALL_BLOCKS_MASK;
 }
@@ -431,20 +450,68 @@ static void calc_bounds_90(uint8_t update_start, uint8_t *cmd_array) {
 #endif
 }
 
-uint8_t crot(uint8_t a, int8_t n) {
-    const uint8_t mask = 0x7;
-    n &= mask;
-    return a << n | a >> (-n & mask);
+static void rotate_90(const uint8_t *src, uint8_t *dest) {
+    // 8x8 bit matrix transpose using fixed masks (Hacker's Delight, 7-3),
+    // bit i of src[j] ends up as bit (7 - j) of dest[i]
+    uint32_t x = ((uint32_t)src[0] << 24) | ((uint32_t)src[1] << 16) | ((uint32_t)src[2] << 8) | src[3];
+    uint32_t y = ((uint32_t)src[4] << 24) | ((uint32_t)src[5] << 16) | ((uint32_t)src[6] << 8) | src[7];
+    uint32_t t;
+
+    t = (x ^ (x >> 7)) & 0x00AA00AA;
+    x = x ^ t ^ (t << 7);
+    t = (y ^ (y >> 7)) & 0x00AA00AA;
+    y = y ^ t ^ (t << 7);
+
+    t = (x ^ (x >> 14)) & 0x0000CCCC;
+    x = x ^ t ^ (t << 14);
+    t = (y ^ (y >> 14)) & 0x0000CCCC;
+    y = y ^ t ^ (t << 14);
+
+    t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+    y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+    x = t;
+
+    dest[0] |= y;
+    dest[1] |= y >> 8;
+    dest[2] |= y >> 16;
+    dest[3] |= y >> 24;
+    dest[4] |= x;
+    dest[5] |= x >> 8;
+    dest[6] |= x >> 16;
+    dest[7] |= x >> 24;
 }
 
-static void rotate_90(const uint8_t *src, uint8_t *dest) {
-    for (uint8_t i = 0, shift = 7; i < 8; ++i, --shift) {
-        uint8_t selector = (1 << i);
-        for (uint8_t j = 0; j < 8; ++j) {
-            dest[i] |= crot(src[j] & selector, shift - (int8_t)j);
+#if defined(OLED_UPDATE_BURST) && OLED_IC_HAS_HORIZONTAL_MODE
+static uint8_t calc_bounds_burst(uint8_t update_start, uint8_t *cmd_array) {
+    // Extend the update to every following dirty block
+    uint8_t update_end = update_start + 1;
+    while (update_end < OLED_BLOCK_COUNT && (oled_dirty & ((OLED_BLOCK_TYPE)1 << update_end))) {
+        ++update_end;
+    }
+
+    uint16_t start = OLED_BLOCK_SIZE * update_start;
+    uint16_t end   = OLED_BLOCK_SIZE * update_end;
+
+    // The controller wraps back to the start column of the window, so a window
+    // spanning several pages has to cover whole pages. Cut the run at the first
+    // page boundary that would break this.
+    if (start / OLED_DISPLAY_WIDTH != (end - 1) / OLED_DISPLAY_WIDTH) {
+        if (start % OLED_DISPLAY_WIDTH) {
+            end = (start / OLED_DISPLAY_WIDTH + 1) * OLED_DISPLAY_WIDTH;
+        } else {
+            end -= end % OLED_DISPLAY_WIDTH;
         }
     }
+
+    // Commands for use in Horizontal Addressing mode.
+    cmd_array[1] = start % OLED_DISPLAY_WIDTH + OLED_COLUMN_OFFSET;
+    cmd_array[2] = (end - 1) % OLED_DISPLAY_WIDTH + OLED_COLUMN_OFFSET;
+    cmd_array[4] = start / OLED_DISPLAY_WIDTH;
+    cmd_array[5] = (end - 1) / OLED_DISPLAY_WIDTH;
+
+    return (end - start) / OLED_BLOCK_SIZE;
 }
+#endif
 
 void oled_render_dirty(bool all) {
     // Do we have work to do?
@@ -470,8 +537,13 @@ void oled_render_dirty(bool all) {
 #else
         static uint8_t display_start[] = {I2C_CMD, PAM_PAGE_ADDR, PAM_SETCOLUMN_LSB, PAM_SETCOLUMN_MSB};
 #endif
+        uint8_t num_blocks = 1;
         if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
+#if defined(OLED_UPDATE_BURST) && OLED_IC_HAS_HORIZONTAL_MODE
+            num_blocks = calc_bounds_burst(update_start, &display_start[1]); // Offset from I2C_CMD byte at the start
+#else
             calc_bounds(update_start, &display_start[1]); // Offset from I2C_CMD byte at the start
+#endif
         } else {
             calc_bounds_90(update_start, &display_start[1]); // Offset from I2C_CMD byte at the start
         }
@@ -483,11 +555,26 @@ void oled_render_dirty(bool all) {
         }
 
         if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
+#if defined(OLED_UPDATE_BURST) && OLED_IC_HAS_HORIZONTAL_MODE
+            // Stream the whole window, the controller keeps advancing its
+            // address pointer across data writes so no further commands are needed
+            uint16_t offset = OLED_BLOCK_SIZE * update_start;
+            uint16_t end    = offset + OLED_BLOCK_SIZE * num_blocks;
+            while (offset < end) {
+                uint16_t size = MIN(end - offset, OLED_UPDATE_BURST_SIZE);
+                if (!oled_send_data(&oled_buffer[offset], size)) {
+                    print("oled_render burst data failed\n");
+                    return;
+                }
+                offset += size;
+            }
+#else
             // Send render data chunk as is
             if (!oled_send_data(&oled_buffer[OLED_BLOCK_SIZE * update_start], OLED_BLOCK_SIZE)) {
                 print("oled_render data failed\n");
                 return;
             }
+#endif
         } else {
             // Rotate the render chunks
             const static uint8_t source_map[] = OLED_SOURCE_MAP;
@@ -527,8 +614,10 @@ void oled_render_dirty(bool all) {
 #endif
         }
 
-        // Clear dirty flag of just rendered block
-        oled_dirty &= ~((OLED_BLOCK_TYPE)1 << update_start);
+        // Clear dirty flags of just rendered blocks
+        while (num_blocks--) {
+            oled_dirty &= ~((OLED_BLOCK_TYPE)1 << update_start++);
+        }
     }
 }
 
@@ -924,6 +1013,153 @@ uint8_t oled_max_lines(void) {
     return OLED_DISPLAY_WIDTH / OLED_FONT_HEIGHT;
 }
 
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_OLED_BUFFER_ENABLE)
+// Contents of the slave's display, drawn on the master and streamed across the split link.
+// Only the framebuffer, its dirty blocks and the cursor are kept per half. The on/off, scrolling,
+// brightness, inversion and rotation state belongs to the master's own display, whichever pass
+// changes it.
+static uint8_t         oled_remote_framebuffer[OLED_MATRIX_SIZE];
+static uint8_t *       oled_remote_buffer = oled_remote_framebuffer;
+static uint8_t *       oled_remote_cursor = oled_remote_framebuffer;
+static OLED_BLOCK_TYPE oled_remote_dirty  = OLED_ALL_BLOCKS_MASK;
+static bool            oled_remote_active = false;
+
+bool is_oled_remote(void) {
+    return oled_remote_active;
+}
+
+void oled_remote_invalidate(void) {
+    oled_remote_dirty = OLED_ALL_BLOCKS_MASK;
+}
+
+// Exchanges the local and remote framebuffers, so the drawing functions target the other half
+static void oled_swap_remote(void) {
+    uint8_t *buffer    = oled_buffer;
+    oled_buffer        = oled_remote_buffer;
+    oled_remote_buffer = buffer;
+
+    uint8_t *cursor    = oled_cursor;
+    oled_cursor        = oled_remote_cursor;
+    oled_remote_cursor = cursor;
+
+    OLED_BLOCK_TYPE dirty = oled_dirty;
+    oled_dirty            = oled_remote_dirty;
+    oled_remote_dirty     = dirty;
+    oled_remote_active    = !oled_remote_active;
+}
+
+// Control bytes below 0x80 are followed by (control + 1) literal bytes,
+// the rest repeat the following byte (control - 0x7E) times
+static uint16_t oled_encode_block(const uint8_t *src, uint8_t *dest) {
+    uint16_t in  = 0;
+    uint16_t out = 0;
+    while (in < OLED_BLOCK_SIZE) {
+        uint16_t run = 1;
+        while (in + run < OLED_BLOCK_SIZE && run < 129 && src[in + run] == src[in]) {
+            ++run;
+        }
+
+        if (run >= 3) {
+            dest[out++] = 0x7E + run;
+            dest[out++] = src[in];
+            in += run;
+            continue;
+        }
+
+        // Collect literals up to the next run worth encoding
+        uint16_t literal = 1;
+        while (in + literal < OLED_BLOCK_SIZE && literal < 128) {
+            const uint8_t *next = &src[in + literal];
+            if (in + literal + 2 < OLED_BLOCK_SIZE && next[0] == next[1] && next[0] == next[2]) {
+                break;
+            }
+            ++literal;
+        }
+        dest[out++] = literal - 1;
+        memcpy(&dest[out], &src[in], literal);
+        out += literal;
+        in += literal;
+    }
+    return out;
+}
+
+uint8_t oled_remote_encode(uint8_t *data, uint8_t size) {
+    uint8_t length = 0;
+    for (uint8_t block = 0; block < OLED_BLOCK_COUNT && oled_remote_dirty; ++block) {
+        OLED_BLOCK_TYPE mask = (OLED_BLOCK_TYPE)1 << block;
+        if (!(oled_remote_dirty & mask)) {
+            continue;
+        }
+
+        uint8_t  record[OLED_REMOTE_RECORD_SIZE];
+        uint16_t record_length = 1 + oled_encode_block(&oled_remote_buffer[block * OLED_BLOCK_SIZE], &record[1]);
+        if (length + record_length > size) {
+            break;
+        }
+        record[0] = block;
+        memcpy(&data[length], record, record_length);
+        length += record_length;
+        oled_remote_dirty &= ~mask;
+    }
+    return length;
+}
+
+void oled_remote_decode(const uint8_t *data, uint8_t size) {
+    uint16_t pos = 0;
+    while (pos < size) {
+        uint8_t block = data[pos++];
+        if (block >= OLED_BLOCK_COUNT) {
+            return;
+        }
+
+        uint8_t *dest   = &oled_buffer[block * OLED_BLOCK_SIZE];
+        uint16_t filled = 0;
+        while (filled < OLED_BLOCK_SIZE) {
+            if (pos >= size) {
+                return;
+            }
+            uint8_t control = data[pos++];
+            if (control & 0x80) {
+                uint16_t count = control - 0x7E;
+                if (pos >= size || filled + count > OLED_BLOCK_SIZE) {
+                    return;
+                }
+                memset(&dest[filled], data[pos++], count);
+                filled += count;
+            } else {
+                uint16_t count = control + 1;
+                if (pos + count > size || filled + count > OLED_BLOCK_SIZE) {
+                    return;
+                }
+                memcpy(&dest[filled], &data[pos], count);
+                pos += count;
+                filled += count;
+            }
+        }
+        oled_dirty |= ((OLED_BLOCK_TYPE)1 << block);
+    }
+}
+#endif // defined(SPLIT_KEYBOARD) && defined(SPLIT_OLED_BUFFER_ENABLE)
+
+static void oled_task_draw(void) {
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_OLED_BUFFER_ENABLE)
+    // The slave only displays what the master draws for it
+    if (!is_keyboard_master()) {
+        return;
+    }
+#endif
+
+    oled_set_cursor(0, 0);
+    oled_task_kb();
+
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_OLED_BUFFER_ENABLE)
+    oled_swap_remote();
+    oled_set_cursor(0, 0);
+    oled_task_kb();
+    oled_swap_remote();
+#endif
+}
+
 void oled_task(void) {
     if (!oled_initialized) {
         return;
@@ -932,12 +1168,10 @@ void oled_task(void) {
 #if OLED_UPDATE_INTERVAL > 0
     if (timer_elapsed(oled_update_timeout) >= OLED_UPDATE_INTERVAL) {
         oled_update_timeout = timer_read();
-        oled_set_cursor(0, 0);
-        oled_task_kb();
+        oled_task_draw();
     }
 #else
-    oled_set_cursor(0, 0);
-    oled_task_kb();
+    oled_task_draw();
 #endif
 
 #if OLED_SCROLL_TIMEOUT > 0
@@ -321,6 +321,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    define OLED_UPDATE_PROCESS_LIMIT 1
 #endif
 
+#if !defined(OLED_UPDATE_BURST_SIZE)
+#    define OLED_UPDATE_BURST_SIZE OLED_DISPLAY_WIDTH
+#endif
+
 typedef struct __attribute__((__packed__)) {
     uint8_t *current_element;
     uint16_t remaining_element_count;
@@ -489,3 +493,29 @@ uint8_t oled_max_chars(void);
 
 // Returns the maximum number of lines that will fit on the oled
 uint8_t oled_max_lines(void);
+
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_OLED_BUFFER_ENABLE)
+// Worst-case size of one encoded block: block index, data and one control byte per 128 literals
+#    define OLED_REMOTE_RECORD_SIZE (2 + OLED_BLOCK_SIZE + OLED_BLOCK_SIZE / 128)
+
+#    if !defined(SPLIT_OLED_BUFFER_SIZE)
+#        define SPLIT_OLED_BUFFER_SIZE OLED_REMOTE_RECORD_SIZE
+#    endif
+
+// The sequence and length bytes travel with the data, a transaction carries at most 255 bytes
+_Static_assert(SPLIT_OLED_BUFFER_SIZE >= OLED_REMOTE_RECORD_SIZE && SPLIT_OLED_BUFFER_SIZE <= 253, "SPLIT_OLED_BUFFER_SIZE must hold at least one encoded block and fit in a single transaction");
+
+// Returns true while oled_task_kb is drawing the slave's display on the master
+// Only the framebuffer and cursor are switched, on/off, scrolling and brightness stay the master's
+bool is_oled_remote(void);
+
+// Packs dirty blocks of the slave's framebuffer into data as run-length encoded records
+// Returns the number of bytes used, 0 when the slave is up to date
+uint8_t oled_remote_encode(uint8_t *data, uint8_t size);
+
+// Applies records produced by oled_remote_encode to the local framebuffer
+void oled_remote_decode(const uint8_t *data, uint8_t size);
+
+// Marks the whole slave framebuffer for resending
+void oled_remote_invalidate(void);
+#endif // defined(SPLIT_KEYBOARD) && defined(SPLIT_OLED_BUFFER_ENABLE)
@@ -28,6 +28,26 @@ void soft_serial_target_init(void);
 
 bool soft_serial_transaction(int sstd_index);
 
+#if defined(SERIAL_USART_SPEED_MAX) && !defined(SERIAL_PROTOCOL_CRC)
+#    define SERIAL_PROTOCOL_CRC
+#endif
+
+#if defined(SERIAL_PROTOCOL_CRC)
+// Link diagnostics of the CRC framed protocol, counted by each half for what it observes
+typedef struct serial_protocol_stats_t {
+    uint32_t frames;          // frames sent (master) or accepted (slave)
+    uint32_t retransmits;     // frames repeated by the master, or answered from the last result by the slave
+    uint32_t failures;        // transactions that failed after all retries
+    uint32_t header_errors;   // corrupted headers and handshakes
+    uint32_t crc_errors;      // payloads failing their CRC
+    uint32_t receive_errors;  // timeouts and UART errors
+    uint32_t speed_fallbacks; // returns to SERIAL_USART_SPEED after the link degraded
+    uint32_t speed;           // current baud rate
+} serial_protocol_stats_t;
+
+const serial_protocol_stats_t *serial_protocol_get_stats(void);
+#endif
+
 #ifdef SERIAL_DEBUG
 #    include <debug.h>
 #    include <print.h>
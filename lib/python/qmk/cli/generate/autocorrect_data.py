@@ -80,6 +80,9 @@ def parse_file(file_name: str) -> List[Tuple[str, str]]:
 
     autocorrections = []
     typos = set()
+    # Every substring of the typos seen so far, mapped to its typo. Checking
+    # against this rather than every other typo keeps large dictionaries fast.
+    substrings = {}
     for line_number, typo, correction in parse_file_lines(file_name):
         if typo in typos:
             cli.log.warning('{fg_red}Error:%d:{fg_reset} Ignoring duplicate typo: "{fg_cyan}%s{fg_reset}"', line_number, typo)
@@ -89,10 +92,11 @@ def parse_file(file_name: str) -> List[Tuple[str, str]]:
         if not (all([c in TYPO_CHARS for c in typo])):
             cli.log.error('{fg_red}Error:%d:{fg_reset} Typo "{fg_cyan}%s{fg_reset}" has characters other than a-z, \' and :.', line_number, typo)
             maybe_exit(1)
-        for other_typo in typos:
-            if typo in other_typo or other_typo in typo:
-                cli.log.error('{fg_red}Error:%d:{fg_reset} Typos may not be substrings of one another, otherwise the longer typo would never trigger: "{fg_cyan}%s{fg_reset}" vs. "{fg_cyan}%s{fg_reset}".', line_number, typo, other_typo)
-                maybe_exit(1)
+        typo_substrings = {typo[i:j] for i in range(len(typo)) for j in range(i + 1, len(typo) + 1)}
+        other_typo = substrings.get(typo) or next((t for t in typo_substrings if t in typos), None)
+        if other_typo:
+            cli.log.error('{fg_red}Error:%d:{fg_reset} Typos may not be substrings of one another, otherwise the longer typo would never trigger: "{fg_cyan}%s{fg_reset}" vs. "{fg_cyan}%s{fg_reset}".', line_number, typo, other_typo)
+            maybe_exit(1)
         if len(typo) < 5:
             cli.log.warning('{fg_yellow}Warning:%d:{fg_reset} It is suggested that typos are at least 5 characters long to avoid false triggers: "{fg_cyan}%s{fg_reset}"', line_number, typo)
         if len(typo) > 127:
@@ -103,6 +107,8 @@ def parse_file(file_name: str) -> List[Tuple[str, str]]:
 
         autocorrections.append((typo, correction))
         typos.add(typo)
+        for substring in typo_substrings:
+            substrings.setdefault(substring, typo)
 
     return autocorrections
 
@@ -165,32 +171,55 @@ def check_typo_against_dictionary(typo: str, line_number: int, correct_words) ->
                 cli.log.warning('{fg_yellow}Warning:%d:{fg_reset} Typo "{fg_cyan}%s{fg_reset}" would falsely trigger on correctly spelled word "{fg_cyan}%s{fg_reset}".', line_number, typo, word)
 
 
-def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any]) -> List[int]:
+def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any], min_link_size: int = 2) -> Tuple[List[int], int]:
     """Serializes trie and correction data in a form readable by the C code.
+
+  Identical subtrees reached through a branch node are only serialized once
+  and shared between all their parents, which turns the trie into a DAWG.
+  This matters for large dictionaries, where many typos share an ending.
   Args:
     autocorrections: List of (typo, correction) tuples.
     trie: Dict of dicts.
+    min_link_size: Smallest size in bytes of node links, 3 forces wide links.
   Returns:
-    List of ints in the range 0-255.
+    List of ints in the range 0-255 and the size in bytes of node links.
   """
     table = []
+    shared = {}
+    keys = {}
+
+    def leaf_data(leaf):
+        typo, correction = leaf
+        word_boundary_ending = typo[-1] == ':'
+        typo = typo.strip(':')
+        i = 0  # Make the autocorrection data for this entry and serialize it.
+        while i < min(len(typo), len(correction)) and typo[i] == correction[i]:
+            i += 1
+        backspaces = len(typo) - i - 1 + word_boundary_ending
+        assert 0 <= backspaces <= 63
+        correction = correction[i:]
+        bs_count = [backspaces + 128]
+        return bs_count + list(bytes(correction, 'ascii')) + [0]
+
+    def node_key(trie_node):
+        """Structural key of a subtree, equal for subtrees that serialize the same."""
+        if id(trie_node) not in keys:
+            if 'LEAF' in trie_node:
+                keys[id(trie_node)] = ('LEAF', tuple(leaf_data(trie_node['LEAF'])))
+            else:
+                keys[id(trie_node)] = tuple((c, node_key(child)) for c, child in sorted(trie_node.items()))
+        return keys[id(trie_node)]
+
+    def traverse_shared(trie_node):
+        key = node_key(trie_node)
+        if key not in shared:
+            shared[key] = traverse(trie_node)
+        return shared[key]
 
     # Traverse trie in depth first order.
     def traverse(trie_node):
         if 'LEAF' in trie_node:  # Handle a leaf trie node.
-            typo, correction = trie_node['LEAF']
-            word_boundary_ending = typo[-1] == ':'
-            typo = typo.strip(':')
-            i = 0  # Make the autocorrection data for this entry and serialize it.
-            while i < min(len(typo), len(correction)) and typo[i] == correction[i]:
-                i += 1
-            backspaces = len(typo) - i - 1 + word_boundary_ending
-            assert 0 <= backspaces <= 63
-            correction = correction[i:]
-            bs_count = [backspaces + 128]
-            data = bs_count + list(bytes(correction, 'ascii')) + [0]
-
-            entry = {'data': data, 'links': [], 'byte_offset': 0}
+            entry = {'data': leaf_data(trie_node['LEAF']), 'links': [], 'byte_offset': 0}
             table.append(entry)
         elif len(trie_node) == 1:  # Handle trie node with a single child.
             c, trie_node = next(iter(trie_node.items()))
@@ -203,16 +232,17 @@ def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any])
                 entry['chars'] += c
 
             table.append(entry)
+            # The child of a chain follows it directly, so it can't be shared.
             entry['links'] = [traverse(trie_node)]
         else:  # Handle trie node with multiple children.
             entry = {'chars': ''.join(sorted(trie_node.keys())), 'byte_offset': 0}
             table.append(entry)
-            entry['links'] = [traverse(trie_node[c]) for c in entry['chars']]
+            entry['links'] = [traverse_shared(trie_node[c]) for c in entry['chars']]
         return entry
 
     traverse(trie)
 
-    def serialize(e: Dict[str, Any]) -> List[int]:
+    def serialize(e: Dict[str, Any], link_size: int) -> List[int]:
         if not e['links']:  # Handle a leaf table entry.
             return e['data']
         elif len(e['links']) == 1:  # Handle a chain table entry.
@@ -220,25 +250,33 @@ def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any])
         else:  # Handle a branch table entry.
             data = []
             for c, link in zip(e['chars'], e['links']):
-                data += [TYPO_CHARS[c] | (0 if data else 64)] + encode_link(link)
+                data += [TYPO_CHARS[c] | (0 if data else 64)] + encode_link(link, link_size)
             return data + [0]
 
-    byte_offset = 0
-    for e in table:  # To encode links, first compute byte offset of each entry.
-        e['byte_offset'] = byte_offset
-        byte_offset += len(serialize(e))
-        assert 0 <= byte_offset <= 0xffff
+    def entry_size(e: Dict[str, Any], link_size: int) -> int:
+        if len(e['links']) > 1:
+            return len(e['links']) * (1 + link_size) + 1
+        return len(e['data']) if not e['links'] else len(e['chars']) + 1
+
+    # Dictionaries over 64KB need wider links.
+    for link_size in range(min_link_size, 4):
+        byte_offset = 0
+        for e in table:  # To encode links, first compute byte offset of each entry.
+            e['byte_offset'] = byte_offset
+            byte_offset += entry_size(e, link_size)
+        if byte_offset < 1 << (8 * link_size):
+            break
 
-    return [b for e in table for b in serialize(e)]  # Serialize final table.
+    return [b for e in table for b in serialize(e, link_size)], link_size  # Serialize final table.
 
 
-def encode_link(link: Dict[str, Any]) -> List[int]:
-    """Encodes a node link as two bytes."""
+def encode_link(link: Dict[str, Any], link_size: int = 2) -> List[int]:
+    """Encodes a node link as `link_size` little endian bytes."""
     byte_offset = link['byte_offset']
-    if not (0 <= byte_offset <= 0xffff):
-        cli.log.error('{fg_red}Error:{fg_reset} The autocorrection table is too large, a node link exceeds 64KB limit. Try reducing the autocorrection dict to fewer entries.')
+    if not (0 <= byte_offset < 1 << (8 * link_size)):
+        cli.log.error('{fg_red}Error:{fg_reset} The autocorrection table is too large, a node link exceeds 16MB limit. Try reducing the autocorrection dict to fewer entries.')
         maybe_exit(1)
-    return [byte_offset & 255, byte_offset >> 8]
+    return [(byte_offset >> (8 * i)) & 255 for i in range(link_size)]
 
 
 def typo_len(e: Tuple[str, str]) -> int:
@@ -254,11 +292,12 @@ def to_hex(b: int) -> str:
 @cli.argument('-km', '--keymap', completer=keymap_completer, help='The keymap to build a firmware for. Ignored when a configurator export is supplied.')
 @cli.argument('-o', '--output', arg_only=True, type=normpath, help='File to write to')
 @cli.argument('-q', '--quiet', arg_only=True, action='store_true', help="Quiet mode, only output error messages")
+@cli.argument('--link-size', arg_only=True, type=int, choices=(2, 3), default=2, help="Smallest size in bytes of node links. Larger dictionaries grow them to 3 bytes on their own.")
 @cli.subcommand('Generate the autocorrection data file from a dictionary file.')
 def generate_autocorrect_data(cli):
     autocorrections = parse_file(cli.args.filename)
     trie = make_trie(autocorrections)
-    data = serialize_trie(autocorrections, trie)
+    data, link_size = serialize_trie(autocorrections, trie, cli.args.link_size)
 
     current_keyboard = cli.args.keyboard or cli.config.user.keyboard or cli.config.generate_autocorrect_data.keyboard
     current_keymap = cli.args.keymap or cli.config.user.keymap or cli.config.generate_autocorrect_data.keymap
@@ -282,6 +321,8 @@ def generate_autocorrect_data(cli):
     autocorrect_data_h_lines.append(f'#define AUTOCORRECT_MIN_LENGTH {len(min_typo)} // "{min_typo}"')
     autocorrect_data_h_lines.append(f'#define AUTOCORRECT_MAX_LENGTH {len(max_typo)} // "{max_typo}"')
     autocorrect_data_h_lines.append(f'#define DICTIONARY_SIZE {len(data)}')
+    if link_size != 2:
+        autocorrect_data_h_lines.append(f'#define AUTOCORRECT_LINK_SIZE {link_size}')
     autocorrect_data_h_lines.append('')
     autocorrect_data_h_lines.append('static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {')
     autocorrect_data_h_lines.append(textwrap.fill('    %s' % (', '.join(map(to_hex, data))), width=100, subsequent_indent='    '))
@@ -219,6 +219,10 @@ def generate_config_h(cli):
     if 'rgb_matrix' in kb_info_json:
         generate_led_animations_config('rgb_matrix', kb_info_json['rgb_matrix'], config_h_lines, 'ENABLE_RGB_MATRIX_', 'RGB_MATRIX_')
 
+        # keyboard.c only carries the polar table when it knows the center
+        if kb_info_json['rgb_matrix'].get('polar_table', False) and 'center_point' in kb_info_json['rgb_matrix']:
+            config_h_lines.append(generate_define('RGB_MATRIX_POLAR_TABLE'))
+
     if 'rgblight' in kb_info_json:
         generate_led_animations_config('rgblight', kb_info_json['rgblight'], config_h_lines, 'RGBLIGHT_EFFECT_', 'RGBLIGHT_MODE_')
 
@@ -1,5 +1,7 @@
 """Used by the make system to generate keyboard.c from info.json.
 """
+from math import isqrt
+
 from milc import cli
 
 from qmk.info import info_json
@@ -56,12 +58,97 @@ def _gen_led_config(info_data, config_type):
     lines.append(f'  {{ {", ".join(pos)} }},')
     lines.append(f'  {{ {", ".join(flags)} }},')
     lines.append('};')
+
+    if config_type == 'rgb_matrix' and 'neighbour_radius' in info_data[config_type]:
+        lines.extend(_gen_led_neighbours(led_layout, info_data[config_type]['neighbour_radius']))
+
+    # Without center_point the effects keep computing around RGB_MATRIX_CENTER, which config.h may set
+    if config_type == 'rgb_matrix' and info_data[config_type].get('polar_table', False) and 'center_point' in info_data[config_type]:
+        lines.extend(_gen_led_polar(led_layout, info_data[config_type]['center_point']))
+
     lines.append('#endif')
     lines.append('')
 
     return lines
 
 
+def _gen_led_neighbours(led_layout, radius):
+    """Generate the sorted list of keyed LEDs within radius of each LED
+    """
+    offsets = ['0']
+    neighbours = []
+
+    for index, led_data in enumerate(led_layout):
+        if 'matrix' in led_data:
+            nearby = []
+            for other_index, other_data in enumerate(led_layout):
+                if other_index == index or 'matrix' not in other_data:
+                    continue
+                dx = led_data.get('x', 0) - other_data.get('x', 0)
+                dy = led_data.get('y', 0) - other_data.get('y', 0)
+                distance = min(isqrt(dx * dx + dy * dy), 255)
+                if distance <= radius:
+                    row, col = other_data['matrix']
+                    nearby.append((distance, row, col))
+            neighbours.extend(f'{{{row}, {col}, {distance}}}' for distance, row, col in sorted(nearby))
+        offsets.append(str(len(neighbours)))
+
+    # Keep the array non-empty so the declaration stays valid
+    if not neighbours:
+        neighbours.append('{0, 0, 255}')
+
+    lines = []
+    lines.append('__attribute__ ((weak)) const uint16_t g_led_neighbour_offsets[] PROGMEM = {')
+    lines.append(f'  {", ".join(offsets)}')
+    lines.append('};')
+    lines.append('__attribute__ ((weak)) const led_neighbour_t g_led_neighbours[] PROGMEM = {')
+    for i in range(0, len(neighbours), 8):
+        lines.append(f'  {", ".join(neighbours[i:i + 8])},')
+    lines.append('};')
+
+    return lines
+
+
+def _c_div(a, b):
+    """Integer division truncating towards zero, as in C
+    """
+    q = abs(a) // abs(b)
+    return q if (a < 0) == (b < 0) else -q
+
+
+def _atan2_8(dy, dx):
+    """Python port of lib8tion's atan2_8()
+    """
+    if dy == 0:
+        return 0 if dx >= 0 else 128
+
+    abs_y = abs(dy)
+    if dx >= 0:
+        a = 32 - _c_div(32 * (dx - abs_y), dx + abs_y)
+    else:
+        a = 96 - _c_div(32 * (dx + abs_y), abs_y - dx)
+
+    return (-a if dy < 0 else a) & 0xFF
+
+
+def _gen_led_polar(led_layout, center):
+    """Generate the angle and distance of each LED around the center point
+    """
+    polar = []
+    for led_data in led_layout:
+        dx = led_data.get('x', 0) - center[0]
+        dy = led_data.get('y', 0) - center[1]
+        polar.append(f'{{{_atan2_8(dy, dx)}, {min(isqrt(dx * dx + dy * dy), 255)}}}')
+
+    lines = []
+    lines.append('__attribute__ ((weak)) const led_polar_t g_led_polar[] PROGMEM = {')
+    for i in range(0, len(polar), 8):
+        lines.append(f'  {", ".join(polar[i:i + 8])},')
+    lines.append('};')
+
+    return lines
+
+
 def _gen_matrix_mask(info_data):
     """Convert info.json content to matrix_mask
     """
@@ -0,0 +1,182 @@
+"""Generate leader_data.h from a list of leader sequences.
+
+Each line of the sequence file defines one sequence and its name with the
+syntax "keycodes -> name". Keycodes are separated by whitespace and are
+emitted verbatim, so anything the C compiler understands can be used. Blank
+lines or lines starting with '#' are ignored.
+
+Example:
+  KC_E KC_D       -> email
+  KC_S KC_D       -> sudo
+  KC_S KC_D KC_A  -> sudo_apt
+
+The sequences are compiled into a trie that `leader_sequence_add()` walks one
+key at a time, so the leader sequence ends as soon as the result is known.
+"""
+import re
+import textwrap
+from typing import Any, Dict, Iterator, List, Tuple
+
+from milc import cli
+
+from qmk.commands import dump_lines
+from qmk.constants import GPL2_HEADER_C_LIKE, GENERATED_HEADER_C_LIKE
+from qmk.keyboard import keyboard_completer, keyboard_folder
+from qmk.keymap import keymap_completer, locate_keymap
+from qmk.path import normpath
+from qmk.util import maybe_exit
+
+# Matches the size of `leader_sequence` in quantum/leader.c
+LEADER_MAX_LENGTH = 5
+# `LEADER_NO_MATCH` is reserved
+LEADER_MAX_SEQUENCES = 255
+LEADER_TRIE_LEAF = 0x8000
+LEADER_NAME_RE = re.compile(r'^[A-Za-z_][A-Za-z0-9_]*$')
+
+
+def parse_file_lines(file_name: str) -> Iterator[Tuple[int, List[str], str]]:
+    """Parses lines read from `file_name` into keycodes-name pairs."""
+
+    line_number = 0
+    for line in open(file_name, 'rt'):
+        line_number += 1
+        line = line.strip()
+        if line and line[0] != '#':
+            tokens = [token.strip() for token in line.split('->', 1)]
+            if len(tokens) != 2 or not tokens[0] or not tokens[1]:
+                cli.log.error('{fg_red}Error:%d:{fg_reset} Invalid syntax: "{fg_cyan}%s{fg_reset}"', line_number, line)
+                maybe_exit(1)
+
+            yield line_number, tokens[0].split(), tokens[1]
+
+
+def parse_file(file_name: str) -> List[Tuple[List[str], str]]:
+    """Parses and validates the leader sequence file.
+
+    Returns:
+        List of (keycodes, name) tuples.
+    """
+    sequences = []
+    seen_keys = set()
+    seen_names = set()
+    for line_number, keycodes, name in parse_file_lines(file_name):
+        if not LEADER_NAME_RE.match(name):
+            cli.log.error('{fg_red}Error:%d:{fg_reset} Sequence name "{fg_cyan}%s{fg_reset}" is not a valid C identifier.', line_number, name)
+            maybe_exit(1)
+        if name.upper() in seen_names:
+            cli.log.error('{fg_red}Error:%d:{fg_reset} Duplicate sequence name "{fg_cyan}%s{fg_reset}".', line_number, name)
+            maybe_exit(1)
+        if len(keycodes) > LEADER_MAX_LENGTH:
+            cli.log.error('{fg_red}Error:%d:{fg_reset} Sequence "{fg_cyan}%s{fg_reset}" is longer than %d keys.', line_number, name, LEADER_MAX_LENGTH)
+            maybe_exit(1)
+        if tuple(keycodes) in seen_keys:
+            cli.log.warning('{fg_yellow}Warning:%d:{fg_reset} Ignoring duplicate sequence: "{fg_cyan}%s{fg_reset}"', line_number, ' '.join(keycodes))
+            continue
+
+        sequences.append((keycodes, name.upper()))
+        seen_keys.add(tuple(keycodes))
+        seen_names.add(name.upper())
+
+    if not sequences:
+        cli.log.error('{fg_red}Error:{fg_reset} No leader sequences found.')
+        maybe_exit(1)
+    if len(sequences) > LEADER_MAX_SEQUENCES:
+        cli.log.error('{fg_red}Error:{fg_reset} Too many leader sequences, at most %d are supported.', LEADER_MAX_SEQUENCES)
+        maybe_exit(1)
+
+    return sequences
+
+
+def make_trie(sequences: List[Tuple[List[str], str]]) -> Dict[str, Any]:
+    """Makes a trie from the sequences, keeping children in file order.
+    """
+    trie = {'children': {}, 'leaf': None}
+    for index, (keycodes, _) in enumerate(sequences):
+        node = trie
+        for keycode in keycodes:
+            node = node['children'].setdefault(keycode, {'children': {}, 'leaf': None})
+        node['leaf'] = index
+
+    return trie
+
+
+def serialize_trie(trie: Dict[str, Any]) -> List[str]:
+    """Serializes the trie into the words read by quantum/leader.c.
+
+    Each node is a header word holding the child count and `LEADER_TRIE_LEAF`,
+    the sequence index for leaf nodes, then a (keycode, node offset) pair per
+    child. Nodes are laid out in depth first order starting with the root.
+    """
+    nodes = []
+
+    def assign(node):
+        node['offset'] = sum(len(n['children']) * 2 + 1 + (n['leaf'] is not None) for n in nodes)
+        nodes.append(node)
+        for child in node['children'].values():
+            assign(child)
+
+    assign(trie)
+
+    table = []
+    for node in nodes:
+        header = len(node['children'])
+        if header > 0xFF:
+            cli.log.error('{fg_red}Error:{fg_reset} A leader sequence prefix has more than 255 continuations.')
+            maybe_exit(1)
+        if node['leaf'] is not None:
+            table.append(f'0x{header | LEADER_TRIE_LEAF:04X}')
+            table.append(str(node['leaf']))
+        else:
+            table.append(f'0x{header:04X}')
+        for keycode, child in node['children'].items():
+            table.append(keycode)
+            table.append(str(child['offset']))
+
+    if len(table) >= 0xFFFF:
+        cli.log.error('{fg_red}Error:{fg_reset} The leader sequence table is too large.')
+        maybe_exit(1)
+
+    return table
+
+
+@cli.argument('filename', type=normpath, help='The leader sequence file')
+@cli.argument('-kb', '--keyboard', type=keyboard_folder, completer=keyboard_completer, help='The keyboard to build a firmware for. Ignored when a configurator export is supplied.')
+@cli.argument('-km', '--keymap', completer=keymap_completer, help='The keymap to build a firmware for. Ignored when a configurator export is supplied.')
+@cli.argument('-o', '--output', arg_only=True, type=normpath, help='File to write to')
+@cli.argument('-q', '--quiet', arg_only=True, action='store_true', help="Quiet mode, only output error messages")
+@cli.subcommand('Generate the leader sequence data file from a sequence file.')
+def generate_leader_data(cli):
+    sequences = parse_file(cli.args.filename)
+    table = serialize_trie(make_trie(sequences))
+
+    current_keyboard = cli.args.keyboard or cli.config.user.keyboard or cli.config.generate_leader_data.keyboard
+    current_keymap = cli.args.keymap or cli.config.user.keymap or cli.config.generate_leader_data.keymap
+
+    if current_keyboard and current_keymap:
+        cli.args.output = locate_keymap(current_keyboard, current_keymap).parent / 'leader_data.h'
+
+    longest = max(len(' '.join(keycodes)) for keycodes, _ in sequences)
+
+    leader_data_h_lines = [GPL2_HEADER_C_LIKE, GENERATED_HEADER_C_LIKE, '#pragma once', '']
+
+    leader_data_h_lines.append(f'// Leader sequences ({len(sequences)} entries):')
+    for keycodes, name in sequences:
+        leader_data_h_lines.append(f'//   {" ".join(keycodes):<{longest}} -> {name}')
+
+    leader_data_h_lines.append('')
+    leader_data_h_lines.append('enum leader_sequences {')
+    for keycodes, name in sequences:
+        leader_data_h_lines.append(f'    LEADER_SEQ_{name},')
+    leader_data_h_lines.append('};')
+
+    leader_data_h_lines.append('')
+    leader_data_h_lines.append('#ifdef LEADER_DATA_IMPLEMENTATION')
+    leader_data_h_lines.append(f'#    define LEADER_TRIE_SIZE {len(table)}')
+    leader_data_h_lines.append('')
+    leader_data_h_lines.append('static const uint16_t leader_trie[LEADER_TRIE_SIZE] PROGMEM = {')
+    leader_data_h_lines.append(textwrap.fill('    %s' % (', '.join(table)), width=100, subsequent_indent='    '))
+    leader_data_h_lines.append('};')
+    leader_data_h_lines.append('#endif')
+
+    # Show the results
+    dump_lines(cli.args.output, leader_data_h_lines, cli.args.quiet)
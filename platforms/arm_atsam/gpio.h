@@ -79,3 +79,12 @@ typedef uint8_t pin_t;
 #define gpio_read_pin(pin) ((PORT->Group[SAMD_PORT(pin)].IN.reg & SAMD_PIN_MASK(pin)) != 0)
 
 #define gpio_toggle_pin(pin) (PORT->Group[SAMD_PORT(pin)].OUTTGL.reg = SAMD_PIN_MASK(pin))
+
+/* Operation of GPIO by port. */
+
+typedef uint32_t port_data_t;
+
+#define gpio_pin_port(pin) SAMD_PORT(pin)
+#define gpio_pin_bit(pin) SAMD_PIN(pin)
+
+#define gpio_read_port(pin) (PORT->Group[SAMD_PORT(pin)].IN.reg)
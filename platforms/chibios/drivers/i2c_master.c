@@ -108,6 +108,28 @@ static const I2CConfig i2cconfig = {
 #endif
 };
 
+#ifdef MATRIX_SCAN_THREAD
+// matrix_scan_kb() may talk to an I/O expander from the scan thread while the
+// main loop drives an OLED or other devices on the same bus
+#    if !I2C_USE_MUTUAL_EXCLUSION
+#        error "MATRIX_SCAN_THREAD requires I2C_USE_MUTUAL_EXCLUSION to be TRUE in halconf.h"
+#    endif
+#    define i2c_acquire_bus() i2cAcquireBus(&I2C_DRIVER)
+#    define i2c_release_bus() i2cReleaseBus(&I2C_DRIVER)
+#else
+#    define i2c_acquire_bus()
+#    define i2c_release_bus()
+#endif
+
+/**
+ * @brief Takes the bus, released again by i2c_epilogue(), and starts the I2C
+ * peripheral.
+ */
+static void i2c_prologue(void) {
+    i2c_acquire_bus();
+    i2cStart(&I2C_DRIVER, &i2cconfig);
+}
+
 /**
  * @brief Handles any I2C error condition by stopping the I2C peripheral and
  * aborting any ongoing transactions. Furthermore ChibiOS status codes are
@@ -118,6 +140,7 @@ static const I2CConfig i2cconfig = {
  */
 static i2c_status_t i2c_epilogue(const msg_t status) {
     if (status == MSG_OK) {
+        i2c_release_bus();
         return I2C_STATUS_SUCCESS;
     }
 
@@ -125,6 +148,7 @@ static i2c_status_t i2c_epilogue(const msg_t status) {
     // restarted because the bus is in an uncertain state." We also issue that
     // hard stop in case of any error.
     i2cStop(&I2C_DRIVER);
+    i2c_release_bus();
 
     return status == MSG_TIMEOUT ? I2C_STATUS_TIMEOUT : I2C_STATUS_ERROR;
 }
@@ -150,19 +174,19 @@ __attribute__((weak)) void i2c_init(void) {
 }
 
 i2c_status_t i2c_transmit(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2cStart(&I2C_DRIVER, &i2cconfig);
+    i2c_prologue();
     msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (address >> 1), data, length, 0, 0, TIME_MS2I(timeout));
     return i2c_epilogue(status);
 }
 
 i2c_status_t i2c_receive(uint8_t address, uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2cStart(&I2C_DRIVER, &i2cconfig);
+    i2c_prologue();
     msg_t status = i2cMasterReceiveTimeout(&I2C_DRIVER, (address >> 1), data, length, TIME_MS2I(timeout));
     return i2c_epilogue(status);
 }
 
 i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2cStart(&I2C_DRIVER, &i2cconfig);
+    i2c_prologue();
 
     uint8_t complete_packet[length + 1];
     for (uint16_t i = 0; i < length; i++) {
@@ -175,7 +199,7 @@ i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t*
 }
 
 i2c_status_t i2c_write_register16(uint8_t devaddr, uint16_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2cStart(&I2C_DRIVER, &i2cconfig);
+    i2c_prologue();
 
     uint8_t complete_packet[length + 2];
     for (uint16_t i = 0; i < length; i++) {
@@ -189,13 +213,13 @@ i2c_status_t i2c_write_register16(uint8_t devaddr, uint16_t regaddr, const uint8
 }
 
 i2c_status_t i2c_read_register(uint8_t devaddr, uint8_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2cStart(&I2C_DRIVER, &i2cconfig);
+    i2c_prologue();
     msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (devaddr >> 1), &regaddr, 1, data, length, TIME_MS2I(timeout));
     return i2c_epilogue(status);
 }
 
 i2c_status_t i2c_read_register16(uint8_t devaddr, uint16_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2cStart(&I2C_DRIVER, &i2cconfig);
+    i2c_prologue();
     uint8_t register_packet[2] = {regaddr >> 8, regaddr & 0xFF};
     msg_t   status             = i2cMasterTransmitTimeout(&I2C_DRIVER, (devaddr >> 1), register_packet, 2, data, length, TIME_MS2I(timeout));
     return i2c_epilogue(status);
@@ -7,8 +7,22 @@
 #include "serial_protocol.h"
 #include "synchronization_util.h"
 
+#if defined(SERIAL_PROTOCOL_CRC)
+#    include <string.h>
+#    include "crc.h"
+#endif
+#if defined(SERIAL_PROTOCOL_CRC) || defined(SERIAL_USART_PIPELINE)
+#    include "serial_usart.h"
+#endif
+#if defined(SERIAL_USART_SPEED_MAX)
+#    include "timer.h"
+#endif
+
 static inline bool initiate_transaction(uint8_t transaction_id);
 static inline bool react_to_transaction(void);
+#if defined(SERIAL_USART_SPEED_MAX)
+static void speed_init(void);
+#endif
 
 /**
  * @brief This thread runs on the slave and responds to transactions initiated
@@ -33,6 +47,9 @@ static THD_FUNCTION(SlaveThread, arg) {
  */
 void soft_serial_target_init(void) {
     serial_transport_driver_slave_init();
+#if defined(SERIAL_USART_SPEED_MAX)
+    speed_init();
+#endif
 
     /* Start transport thread. */
     chThdCreateStatic(waSlaveThread, sizeof(waSlaveThread), HIGHPRIO, SlaveThread, NULL);
@@ -43,8 +60,228 @@ void soft_serial_target_init(void) {
  */
 void soft_serial_initiator_init(void) {
     serial_transport_driver_master_init();
+#if defined(SERIAL_USART_SPEED_MAX)
+    speed_init();
+#endif
+}
+
+#if defined(SERIAL_USART_PIPELINE)
+
+#    if !defined(SERIAL_USART_FULL_DUPLEX)
+#        error SERIAL_USART_PIPELINE requires SERIAL_USART_FULL_DUPLEX
+#    endif
+#    if defined(SERIAL_PROTOCOL_CRC)
+#        error SERIAL_USART_PIPELINE can not be combined with SERIAL_PROTOCOL_CRC
+#    endif
+
+/*
+ * Pipelined full-duplex protocol. The master sends the transaction ID and its buffer in one go and
+ * the slave answers with the XORed handshake followed by its buffer, which saves waiting for the
+ * handshake before every transaction. Plain writes, without a reply or slave callback, are not
+ * waited for at all, up to SERIAL_USART_PIPELINE_BYTES of them are streamed back-to-back while the
+ * slave works through them from its receive queue. Their handshakes are collected before the next
+ * reply is read. A write whose handshake does not arrive has already been reported as done, so it
+ * is sent again ahead of the next transaction, with whatever its buffer holds by then. Repeating a
+ * plain write is harmless, transactions with a slave callback could not be repeated like that and
+ * always wait for their own handshake.
+ */
+
+#    define SERIAL_PIPELINE_DEPTH 8
+
+static uint8_t  pipeline_ids[SERIAL_PIPELINE_DEPTH];
+static uint8_t  pipeline_count  = 0;
+static size_t   pipeline_bytes  = 0;
+static uint32_t pipeline_resend = 0;
+
+/**
+ * @brief React to transactions started by the master.
+ */
+static inline bool react_to_transaction(void) {
+    uint8_t transaction_id = 0;
+    /* Wait until there is a transaction for us. */
+    if (unlikely(!serial_transport_receive_blocking(&transaction_id, sizeof(transaction_id)))) {
+        return false;
+    }
+
+    /* Sanity check that we are actually responding to a valid transaction. */
+    if (unlikely(transaction_id >= NUM_TOTAL_TRANSACTIONS)) {
+        return false;
+    }
+
+    split_shared_memory_lock_autounlock();
+
+    split_transaction_desc_t* transaction = &split_transaction_table[transaction_id];
+
+    /* The transaction buffer follows the ID without waiting for a handshake. */
+    if (transaction->initiator2target_buffer_size) {
+        if (unlikely(!serial_transport_receive(split_trans_initiator2target_buffer(transaction), transaction->initiator2target_buffer_size))) {
+            return false;
+        }
+    }
+
+    /* Allow any slave processing to occur. */
+    if (transaction->slave_callback) {
+        transaction->slave_callback(transaction->initiator2target_buffer_size, split_trans_initiator2target_buffer(transaction), transaction->initiator2target_buffer_size, split_trans_target2initiator_buffer(transaction));
+    }
+
+    /* Send back the handshake, directly followed by the transaction buffer if there is one. */
+    transaction_id ^= NUM_TOTAL_TRANSACTIONS;
+    if (unlikely(!serial_transport_send(&transaction_id, sizeof(transaction_id)))) {
+        return false;
+    }
+
+    if (transaction->target2initiator_buffer_size) {
+        if (unlikely(!serial_transport_send(split_trans_target2initiator_buffer(transaction), transaction->target2initiator_buffer_size))) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Forgets the pipelined transactions, those from the first unconfirmed one on are sent again.
+ */
+static void pipeline_reset(uint8_t confirmed) {
+    for (uint8_t i = confirmed; i < pipeline_count; i++) {
+        pipeline_resend |= (uint32_t)1 << pipeline_ids[i];
+    }
+
+    pipeline_count = 0;
+    pipeline_bytes = 0;
+}
+
+#    ifdef SPLIT_TRANSACTION_STATS_ENABLE
+/**
+ * @brief Charges the wait for a handshake to the pipelined transaction it confirms, not to the
+ * transaction that happens to collect it.
+ */
+static void pipeline_charge(uint8_t index, systime_t* since) {
+    systime_t now = chVTGetSystemTimeX();
+    split_transaction_confirmed(pipeline_ids[index], chTimeI2US(chTimeDiffX(*since, now)));
+    *since = now;
+}
+#    else
+#        define pipeline_charge(index, since)
+#    endif // SPLIT_TRANSACTION_STATS_ENABLE
+
+/**
+ * @brief Collects the handshakes of all pipelined transactions.
+ */
+static bool pipeline_drain(void) {
+    uint8_t confirmed = 0;
+#    ifdef SPLIT_TRANSACTION_STATS_ENABLE
+    systime_t since = chVTGetSystemTimeX();
+#    endif // SPLIT_TRANSACTION_STATS_ENABLE
+    while (confirmed < pipeline_count) {
+        uint8_t transaction_id_shake = 0xFF;
+        bool    okay                 = serial_transport_receive(&transaction_id_shake, sizeof(transaction_id_shake)) && (transaction_id_shake == (pipeline_ids[confirmed] ^ NUM_TOTAL_TRANSACTIONS));
+        pipeline_charge(confirmed, &since);
+        if (unlikely(!okay)) {
+            serial_dprintf("SPLIT: pipelined transaction failed\n");
+            break;
+        }
+        confirmed++;
+    }
+
+    bool okay = confirmed == pipeline_count;
+    pipeline_reset(confirmed);
+    if (unlikely(!okay)) {
+        serial_transport_driver_clear();
+    }
+    return okay;
+}
+
+/**
+ * @brief Sends a transaction to the slave half, shared memory must already be locked.
+ */
+static bool pipeline_transaction(uint8_t transaction_id) {
+    split_transaction_desc_t* transaction = &split_transaction_table[transaction_id];
+    size_t                    frame_size  = sizeof(transaction_id) + transaction->initiator2target_buffer_size;
+    bool                      pipelined   = !transaction->target2initiator_buffer_size && !transaction->slave_callback && frame_size <= SERIAL_USART_PIPELINE_BYTES;
+
+    if (pipeline_count == 0) {
+        /* Clear the receive queue, to start with a clean slate.
+         * Parts of failed transactions or spurious bytes could still be in it. */
+        serial_transport_driver_clear();
+        pipeline_bytes = 0;
+    } else if (pipeline_count == SERIAL_PIPELINE_DEPTH || pipeline_bytes + frame_size > SERIAL_USART_PIPELINE_BYTES) {
+        /* Let the slave catch up before its receive queue overflows. */
+        if (unlikely(!pipeline_drain())) {
+            return false;
+        }
+    }
+
+    /* Send the transaction table index to the slave, directly followed by the transaction buffer. */
+    if (unlikely(!serial_transport_send(&transaction_id, sizeof(transaction_id)))) {
+        serial_dprintf("SPLIT: sending handshake failed\n");
+        pipeline_reset(0);
+        return false;
+    }
+
+    if (transaction->initiator2target_buffer_size) {
+        if (unlikely(!serial_transport_send(split_trans_initiator2target_buffer(transaction), transaction->initiator2target_buffer_size))) {
+            serial_dprintf("SPLIT: sending buffer failed\n");
+            pipeline_reset(0);
+            return false;
+        }
+    }
+
+    /* Nothing to read back, the handshake is collected later on. */
+    if (pipelined) {
+        pipeline_ids[pipeline_count++] = transaction_id;
+        pipeline_bytes += frame_size;
+        return true;
+    }
+
+    /* The handshakes of pipelined transactions arrive first. */
+    if (pipeline_count && unlikely(!pipeline_drain())) {
+        return false;
+    }
+
+    uint8_t transaction_id_shake = 0xFF;
+    if (unlikely(!serial_transport_receive(&transaction_id_shake, sizeof(transaction_id_shake)) || (transaction_id_shake != (transaction_id ^ NUM_TOTAL_TRANSACTIONS)))) {
+        serial_dprintf("SPLIT: receiving handshake failed\n");
+        return false;
+    }
+
+    /* Receive transaction buffer from the slave. If this transaction requires it. */
+    if (transaction->target2initiator_buffer_size) {
+        if (unlikely(!serial_transport_receive(split_trans_target2initiator_buffer(transaction), transaction->target2initiator_buffer_size))) {
+            serial_dprintf("SPLIT: receiving buffer failed\n");
+            return false;
+        }
+    }
+
+    return true;
 }
 
+/**
+ * @brief Initiate transaction to slave half.
+ */
+static inline bool initiate_transaction(uint8_t transaction_id) {
+    /* Sanity check that we are actually starting a valid transaction. */
+    if (unlikely(transaction_id >= NUM_TOTAL_TRANSACTIONS)) {
+        serial_dprintf("SPLIT: illegal transaction id\n");
+        return false;
+    }
+
+    split_shared_memory_lock_autounlock();
+
+    /* Unconfirmed writes go first, this transaction fails if they can not be delivered either. */
+    while (pipeline_resend) {
+        uint8_t resend_id = (uint8_t)__builtin_ctz(pipeline_resend);
+        pipeline_resend &= ~((uint32_t)1 << resend_id);
+        if (resend_id != transaction_id && unlikely(!pipeline_transaction(resend_id))) {
+            return false;
+        }
+    }
+
+    return pipeline_transaction(transaction_id);
+}
+
+#elif !defined(SERIAL_PROTOCOL_CRC)
+
 /**
  * @brief React to transactions started by the master.
  */
@@ -93,20 +330,6 @@ static inline bool react_to_transaction(void) {
     return true;
 }
 
-/**
- * @brief Start transaction from the master half to the slave half.
- *
- * @param index Transaction Table index of the transaction to start.
- * @return bool Indicates success of transaction.
- */
-bool soft_serial_transaction(int index) {
-    /* Clear the receive queue, to start with a clean slate.
-     * Parts of failed transactions or spurious bytes could still be in it. */
-    serial_transport_driver_clear();
-
-    return initiate_transaction((uint8_t)index);
-}
-
 /**
  * @brief Initiate transaction to slave half.
  */
@@ -156,3 +379,454 @@ static inline bool initiate_transaction(uint8_t transaction_id) {
 
     return true;
 }
+
+#else
+
+/*
+ * CRC framed protocol, every transaction is carried as:
+ *
+ *   master: [id, sequence, crc8]                       frame header
+ *   slave:  [id ^ NUM_TOTAL_TRANSACTIONS]              handshake, or SERIAL_FRAME_NAK for a bad header
+ *   master: [initiator2target buffer, crc16]           if the transaction has one
+ *   slave:  [SERIAL_FRAME_ACK, target2initiator buffer, crc16], or SERIAL_FRAME_NAK for a bad buffer
+ *
+ * Corrupted frames are repeated with the same sequence number. If the slave already executed the
+ * repeated frame it flags the handshake with SERIAL_FRAME_DUPLICATE, the master then skips sending
+ * its buffer and the slave only sends its reply again. Received buffers are checked before they are
+ * copied into the shared memory, so a corrupted transfer never reaches it.
+ */
+
+#    define SERIAL_FRAME_HEADER_SIZE 3
+#    define SERIAL_FRAME_CRC_SIZE 2
+#    define SERIAL_FRAME_ACK 0x06
+#    define SERIAL_FRAME_NAK 0xFF
+#    define SERIAL_FRAME_DUPLICATE 0x80
+// Transaction IDs use 5 bits (see transaction_id_define.h), control frames use the IDs above them
+#    define SERIAL_FRAME_ID_SPEED 0x20 // | speed index, switches to SERIAL_USART_SPEED_MAX >> index
+#    define SERIAL_FRAME_ID_PROBE 0x30 // echoes a test pattern
+
+#    ifndef SERIAL_PROTOCOL_RETRIES
+#        define SERIAL_PROTOCOL_RETRIES 2
+#    endif
+
+typedef enum {
+    FRAME_OK,
+    FRAME_CORRUPTED,
+    FRAME_TIMEOUT,
+} frame_result_t;
+
+static serial_protocol_stats_t serial_stats = {.speed = SERIAL_USART_SPEED};
+// Status byte, the largest transaction buffer and its CRC
+static uint8_t frame_buffer[1 + UINT8_MAX + SERIAL_FRAME_CRC_SIZE];
+
+const serial_protocol_stats_t* serial_protocol_get_stats(void) {
+    return &serial_stats;
+}
+
+static inline void frame_seal(uint8_t* data, size_t size) {
+    uint16_t crc   = crc16(data, size);
+    data[size]     = crc & 0xFF;
+    data[size + 1] = crc >> 8;
+}
+
+static inline bool frame_check(const uint8_t* data, size_t size) {
+    uint16_t crc = crc16(data, size);
+    return data[size] == (crc & 0xFF) && data[size + 1] == (crc >> 8);
+}
+
+static inline bool send_nak(void) {
+    uint8_t nak = SERIAL_FRAME_NAK;
+    return serial_transport_send(&nak, sizeof(nak));
+}
+
+#    if defined(SERIAL_USART_SPEED_MAX)
+
+#        ifndef SERIAL_PROTOCOL_SPEED_ERRORS
+#            define SERIAL_PROTOCOL_SPEED_ERRORS 8
+#        endif
+#        ifndef SERIAL_PROTOCOL_SPEED_TIMEOUT
+#            define SERIAL_PROTOCOL_SPEED_TIMEOUT 250
+#        endif
+#        ifndef SERIAL_PROTOCOL_SPEED_PROBES
+#            define SERIAL_PROTOCOL_SPEED_PROBES 32
+#        endif
+
+#        define SERIAL_SPEED_COUNT 8
+#        define SERIAL_SPEED_BASE 0xFF
+// How long the slave waits after acknowledging a speed change, the master waits twice as long
+#        define SERIAL_SPEED_SETTLE_MS 1
+
+static uint8_t  speed_index     = SERIAL_SPEED_BASE;
+static uint8_t  speed_candidate = 0;
+static uint8_t  speed_errors    = 0;
+static bool     speed_link_up   = false;
+static uint32_t speed_timer     = 0;
+
+// Set by an acknowledged speed frame, the slave switches once the shared memory is unlocked
+static bool    speed_change_pending = false;
+static uint8_t speed_change_index   = 0;
+
+// Probe pattern with long runs and every bit toggling
+static const uint8_t speed_probe_pattern[] = {0x00, 0xFF, 0x55, 0xAA, 0x0F, 0xF0, 0x33, 0xCC, 0x01, 0x80, 0xFE, 0x7F, 0x00, 0x00, 0xFF, 0xFF};
+static uint8_t       speed_probe_buffer[sizeof(speed_probe_pattern)];
+
+static inline bool speed_valid(uint8_t index) {
+    return index < SERIAL_SPEED_COUNT && (SERIAL_USART_SPEED_MAX >> index) > SERIAL_USART_SPEED;
+}
+
+static void speed_set(uint8_t index) {
+    speed_index        = index;
+    speed_errors       = 0;
+    speed_timer        = timer_read32();
+    serial_stats.speed = index == SERIAL_SPEED_BASE ? SERIAL_USART_SPEED : SERIAL_USART_SPEED_MAX >> index;
+    serial_transport_driver_set_speed(serial_stats.speed);
+    serial_dprintf("SPLIT: link speed %lu baud\n", (unsigned long)serial_stats.speed);
+}
+
+/**
+ * @brief Starts the link over at SERIAL_USART_SPEED, negotiation starts again from the fastest speed.
+ */
+static void speed_init(void) {
+    if (speed_index != SERIAL_SPEED_BASE) {
+        speed_set(SERIAL_SPEED_BASE);
+    }
+    speed_candidate      = 0;
+    speed_errors         = 0;
+    speed_link_up        = false;
+    speed_change_pending = false;
+}
+
+/**
+ * @brief Falls back to SERIAL_USART_SPEED once too many transactions in a row failed. The slave
+ * also falls back when it does not receive a valid frame for SERIAL_PROTOCOL_SPEED_TIMEOUT.
+ */
+static void speed_report(bool okay) {
+    speed_link_up = okay;
+    if (okay) {
+        speed_errors = 0;
+        speed_timer  = timer_read32();
+        return;
+    }
+
+    if (speed_index != SERIAL_SPEED_BASE && ++speed_errors >= SERIAL_PROTOCOL_SPEED_ERRORS) {
+        serial_stats.speed_fallbacks++;
+        // The master renegotiates starting one step below
+        speed_candidate = speed_index + 1;
+        speed_set(SERIAL_SPEED_BASE);
+    }
+}
+#    endif
+
+/**
+ * @brief Receives the first byte of a frame header, waiting as long as it takes.
+ */
+static inline bool receive_frame_start(uint8_t* byte) {
+#    if defined(SERIAL_USART_SPEED_MAX)
+    while (speed_index != SERIAL_SPEED_BASE) {
+        if (serial_transport_receive(byte, 1)) {
+            return true;
+        }
+        if (timer_elapsed32(speed_timer) > SERIAL_PROTOCOL_SPEED_TIMEOUT) {
+            serial_stats.speed_fallbacks++;
+            speed_set(SERIAL_SPEED_BASE);
+        }
+    }
+#    endif
+    return serial_transport_receive_blocking(byte, 1);
+}
+
+/**
+ * @brief React to frames sent by the master.
+ */
+static inline bool react_to_frame(void) {
+    static bool    last_valid    = false;
+    static uint8_t last_id       = 0;
+    static uint8_t last_sequence = 0;
+
+    uint8_t header[SERIAL_FRAME_HEADER_SIZE];
+    /* Wait until there is a frame for us. */
+    if (unlikely(!receive_frame_start(header))) {
+        return false;
+    }
+    if (unlikely(!serial_transport_receive(header + 1, SERIAL_FRAME_HEADER_SIZE - 1))) {
+        serial_stats.receive_errors++;
+        return false;
+    }
+    if (unlikely(crc8(header, SERIAL_FRAME_HEADER_SIZE - 1) != header[SERIAL_FRAME_HEADER_SIZE - 1])) {
+        serial_stats.header_errors++;
+        send_nak();
+        return false;
+    }
+
+    uint8_t                   frame_id              = header[0];
+    uint8_t                   sequence              = header[1];
+    split_transaction_desc_t* transaction           = NULL;
+    uint8_t*                  initiator2target      = NULL;
+    uint8_t                   initiator2target_size = 0;
+    uint8_t*                  target2initiator      = NULL;
+    uint8_t                   target2initiator_size = 0;
+
+    split_shared_memory_lock_autounlock();
+
+    if (frame_id < NUM_TOTAL_TRANSACTIONS) {
+        transaction           = &split_transaction_table[frame_id];
+        initiator2target      = split_trans_initiator2target_buffer(transaction);
+        initiator2target_size = transaction->initiator2target_buffer_size;
+        target2initiator      = split_trans_target2initiator_buffer(transaction);
+        target2initiator_size = transaction->target2initiator_buffer_size;
+#    if defined(SERIAL_USART_SPEED_MAX)
+    } else if (frame_id == SERIAL_FRAME_ID_PROBE) {
+        initiator2target      = speed_probe_buffer;
+        initiator2target_size = sizeof(speed_probe_buffer);
+        target2initiator      = speed_probe_buffer;
+        target2initiator_size = sizeof(speed_probe_buffer);
+    } else if ((frame_id & ~(SERIAL_SPEED_COUNT - 1)) == SERIAL_FRAME_ID_SPEED && speed_valid(frame_id & (SERIAL_SPEED_COUNT - 1))) {
+        /* Acknowledged at the current speed, switched below. */
+#    endif
+    } else {
+        serial_stats.header_errors++;
+        send_nak();
+        return false;
+    }
+
+    bool    duplicate = transaction && last_valid && frame_id == last_id && sequence == last_sequence;
+    uint8_t handshake = (frame_id ^ NUM_TOTAL_TRANSACTIONS) | (duplicate ? SERIAL_FRAME_DUPLICATE : 0);
+    if (unlikely(!serial_transport_send(&handshake, sizeof(handshake)))) {
+        return false;
+    }
+
+    if (duplicate) {
+        /* The reply got lost, the callback already ran. */
+        serial_stats.retransmits++;
+    } else {
+        if (initiator2target_size) {
+            if (unlikely(!serial_transport_receive(frame_buffer, initiator2target_size + SERIAL_FRAME_CRC_SIZE))) {
+                serial_stats.receive_errors++;
+                return false;
+            }
+            if (unlikely(!frame_check(frame_buffer, initiator2target_size))) {
+                serial_stats.crc_errors++;
+                send_nak();
+                return false;
+            }
+            memcpy(initiator2target, frame_buffer, initiator2target_size);
+        }
+
+        if (transaction) {
+            /* Allow any slave processing to occur. */
+            if (transaction->slave_callback) {
+                transaction->slave_callback(transaction->initiator2target_buffer_size, split_trans_initiator2target_buffer(transaction), transaction->initiator2target_buffer_size, split_trans_target2initiator_buffer(transaction));
+            }
+            last_valid    = true;
+            last_id       = frame_id;
+            last_sequence = sequence;
+        }
+    }
+    serial_stats.frames++;
+
+    size_t reply_size = 1;
+    frame_buffer[0]   = SERIAL_FRAME_ACK;
+    if (target2initiator_size) {
+        memcpy(frame_buffer + 1, target2initiator, target2initiator_size);
+        frame_seal(frame_buffer + 1, target2initiator_size);
+        reply_size += target2initiator_size + SERIAL_FRAME_CRC_SIZE;
+    }
+    if (unlikely(!serial_transport_send(frame_buffer, reply_size))) {
+        return false;
+    }
+
+#    if defined(SERIAL_USART_SPEED_MAX)
+    if (!transaction && frame_id != SERIAL_FRAME_ID_PROBE) {
+        speed_change_pending = true;
+        speed_change_index   = frame_id & (SERIAL_SPEED_COUNT - 1);
+    }
+#    endif
+
+    return true;
+}
+
+/**
+ * @brief React to transactions started by the master.
+ */
+static inline bool react_to_transaction(void) {
+    bool okay = react_to_frame();
+#    if defined(SERIAL_USART_SPEED_MAX)
+    if (speed_change_pending) {
+        /* Let the acknowledge leave the UART before switching, the master waits twice as long. */
+        speed_change_pending = false;
+        chThdSleepMilliseconds(SERIAL_SPEED_SETTLE_MS);
+        speed_set(speed_change_index);
+    }
+    speed_report(okay);
+#    endif
+    return okay;
+}
+
+/**
+ * @brief Sends one frame to the slave and receives its reply.
+ */
+static frame_result_t initiate_frame_once(uint8_t frame_id, uint8_t sequence, const uint8_t* initiator2target, uint8_t initiator2target_size, uint8_t* target2initiator, uint8_t target2initiator_size) {
+    uint8_t header[SERIAL_FRAME_HEADER_SIZE] = {frame_id, sequence, 0};
+    header[SERIAL_FRAME_HEADER_SIZE - 1]     = crc8(header, SERIAL_FRAME_HEADER_SIZE - 1);
+
+    if (unlikely(!serial_transport_send(header, sizeof(header)))) {
+        serial_dprintf("SPLIT: sending header failed\n");
+        return FRAME_CORRUPTED;
+    }
+
+    uint8_t handshake = 0;
+    if (unlikely(!serial_transport_receive(&handshake, sizeof(handshake)))) {
+        serial_dprintf("SPLIT: receiving handshake failed\n");
+        serial_stats.receive_errors++;
+        return FRAME_TIMEOUT;
+    }
+    if (unlikely((handshake & ~SERIAL_FRAME_DUPLICATE) != (frame_id ^ NUM_TOTAL_TRANSACTIONS))) {
+        serial_dprintf("SPLIT: bad handshake\n");
+        serial_stats.header_errors++;
+        return FRAME_CORRUPTED;
+    }
+
+    /* Send transaction buffer to the slave, unless it already has it. */
+    if (initiator2target_size && !(handshake & SERIAL_FRAME_DUPLICATE)) {
+        memcpy(frame_buffer, initiator2target, initiator2target_size);
+        frame_seal(frame_buffer, initiator2target_size);
+        if (unlikely(!serial_transport_send(frame_buffer, initiator2target_size + SERIAL_FRAME_CRC_SIZE))) {
+            serial_dprintf("SPLIT: sending buffer failed\n");
+            return FRAME_CORRUPTED;
+        }
+    }
+
+    if (unlikely(!serial_transport_receive(frame_buffer, 1))) {
+        serial_dprintf("SPLIT: receiving status failed\n");
+        serial_stats.receive_errors++;
+        return FRAME_TIMEOUT;
+    }
+    if (unlikely(frame_buffer[0] != SERIAL_FRAME_ACK)) {
+        serial_dprintf("SPLIT: buffer rejected\n");
+        return FRAME_CORRUPTED;
+    }
+
+    /* Receive transaction buffer from the slave. If this transaction requires it. */
+    if (target2initiator_size) {
+        if (unlikely(!serial_transport_receive(frame_buffer, target2initiator_size + SERIAL_FRAME_CRC_SIZE))) {
+            serial_dprintf("SPLIT: receiving buffer failed\n");
+            serial_stats.receive_errors++;
+            return FRAME_TIMEOUT;
+        }
+        if (unlikely(!frame_check(frame_buffer, target2initiator_size))) {
+            serial_dprintf("SPLIT: buffer CRC mismatch\n");
+            serial_stats.crc_errors++;
+            return FRAME_CORRUPTED;
+        }
+        memcpy(target2initiator, frame_buffer, target2initiator_size);
+    }
+
+    return FRAME_OK;
+}
+
+/**
+ * @brief Sends a frame to the slave, repeating it up to SERIAL_PROTOCOL_RETRIES times. Timeouts
+ * are only retried while the link is up, so a missing slave does not stall the master.
+ */
+static bool initiate_frame(uint8_t frame_id, const uint8_t* initiator2target, uint8_t initiator2target_size, uint8_t* target2initiator, uint8_t target2initiator_size) {
+    static uint8_t sequence = 0;
+    static bool    link_up  = false;
+
+    sequence++;
+    serial_stats.frames++;
+
+    for (uint8_t attempt = 0;; attempt++) {
+        frame_result_t result = initiate_frame_once(frame_id, sequence, initiator2target, initiator2target_size, target2initiator, target2initiator_size);
+        if (likely(result == FRAME_OK)) {
+            link_up = true;
+            return true;
+        }
+        if (attempt >= SERIAL_PROTOCOL_RETRIES || (result == FRAME_TIMEOUT && !link_up)) {
+            break;
+        }
+
+        serial_stats.retransmits++;
+        serial_transport_driver_clear();
+    }
+
+    link_up = false;
+    serial_stats.failures++;
+    return false;
+}
+
+#    if defined(SERIAL_USART_SPEED_MAX)
+/**
+ * @brief Tries the next faster speed once the link works at SERIAL_USART_SPEED. The speed is kept
+ * if every probe frame passes at it on the first attempt, otherwise the next slower one is tried.
+ */
+static void speed_negotiate(void) {
+    uint8_t index = speed_candidate;
+    if (likely(speed_index != SERIAL_SPEED_BASE || !speed_link_up || !speed_valid(index))) {
+        return;
+    }
+    speed_candidate = index + 1;
+
+    /* Announced at the current speed, the slave switches after acknowledging. */
+    if (!initiate_frame(SERIAL_FRAME_ID_SPEED | index, NULL, 0, NULL, 0)) {
+        return;
+    }
+    chThdSleepMilliseconds(2 * SERIAL_SPEED_SETTLE_MS);
+    speed_set(index);
+    serial_transport_driver_clear();
+
+    for (uint8_t probe = 0; probe < SERIAL_PROTOCOL_SPEED_PROBES; probe++) {
+        memset(speed_probe_buffer, 0, sizeof(speed_probe_buffer));
+        if (initiate_frame_once(SERIAL_FRAME_ID_PROBE, probe, speed_probe_pattern, sizeof(speed_probe_pattern), speed_probe_buffer, sizeof(speed_probe_buffer)) != FRAME_OK || memcmp(speed_probe_buffer, speed_probe_pattern, sizeof(speed_probe_pattern)) != 0) {
+            serial_dprintf("SPLIT: link unreliable at %lu baud\n", (unsigned long)serial_stats.speed);
+            /* The slave falls back on its own once it stops receiving valid frames. */
+            speed_set(SERIAL_SPEED_BASE);
+            speed_link_up = false;
+            return;
+        }
+        serial_transport_driver_clear();
+    }
+}
+#    endif
+
+/**
+ * @brief Initiate transaction to slave half.
+ */
+static inline bool initiate_transaction(uint8_t transaction_id) {
+    /* Sanity check that we are actually starting a valid transaction. */
+    if (unlikely(transaction_id >= NUM_TOTAL_TRANSACTIONS)) {
+        serial_dprintf("SPLIT: illegal transaction id\n");
+        return false;
+    }
+
+#    if defined(SERIAL_USART_SPEED_MAX)
+    speed_negotiate();
+#    endif
+
+    split_shared_memory_lock_autounlock();
+
+    split_transaction_desc_t* transaction = &split_transaction_table[transaction_id];
+
+    bool okay = initiate_frame(transaction_id, split_trans_initiator2target_buffer(transaction), transaction->initiator2target_buffer_size, split_trans_target2initiator_buffer(transaction), transaction->target2initiator_buffer_size);
+#    if defined(SERIAL_USART_SPEED_MAX)
+    speed_report(okay);
+#    endif
+    return okay;
+}
+
+#endif
+
+/**
+ * @brief Start transaction from the master half to the slave half.
+ *
+ * @param index Transaction Table index of the transaction to start.
+ * @return bool Indicates success of transaction.
+ */
+bool soft_serial_transaction(int index) {
+#if !defined(SERIAL_USART_PIPELINE)
+    /* Clear the receive queue, to start with a clean slate.
+     * Parts of failed transactions or spurious bytes could still be in it. */
+    serial_transport_driver_clear();
+#endif
+
+    return initiate_transaction((uint8_t)index);
+}
@@ -47,3 +47,9 @@ bool __attribute__((nonnull, hot)) serial_transport_receive_blocking(uint8_t* de
  * @return false Send failed, e.g. by timeout or bit errors.
  */
 bool __attribute__((nonnull, hot)) serial_transport_send(const uint8_t* source, const size_t size);
+
+/**
+ * @brief Switches the link to another baud rate, used by the protocol when SERIAL_USART_SPEED_MAX
+ * is defined. Any transfer still in progress is lost.
+ */
+void serial_transport_driver_set_speed(uint32_t speed);
@@ -50,6 +50,14 @@ static inline void usart_driver_start(void) {
     sdStart(serial_driver, &serial_config);
 }
 
+#    if defined(SERIAL_USART_SPEED_MAX)
+void serial_transport_driver_set_speed(uint32_t speed) {
+    sdStop(serial_driver);
+    serial_config.speed = speed;
+    sdStart(serial_driver, &serial_config);
+}
+#    endif
+
 inline void serial_transport_driver_clear(void) {
     osalSysLock();
     bool volatile queue_not_empty = !iqIsEmptyI(&serial_driver->iqueue);
@@ -80,6 +88,14 @@ static inline void usart_driver_start(void) {
     sioStart(serial_driver, &serial_config);
 }
 
+#    if defined(SERIAL_USART_SPEED_MAX)
+void serial_transport_driver_set_speed(uint32_t speed) {
+    sioStop(serial_driver);
+    serial_config.baud = speed;
+    sioStart(serial_driver, &serial_config);
+}
+#    endif
+
 inline void serial_transport_driver_clear(void) {
     if (sioHasRXErrorsX(serial_driver)) {
         sioGetAndClearErrors(serial_driver);
@@ -44,6 +44,16 @@
 #    define SERIAL_USART_TIMEOUT 20
 #endif
 
+#if !defined(SERIAL_USART_PIPELINE_BYTES)
+#    if HAL_USE_SERIAL && !defined(SERIAL_DRIVER_VENDOR)
+// Pipelined transactions wait in the interrupt driven input queue of the slave
+#        define SERIAL_USART_PIPELINE_BYTES SERIAL_BUFFERS_SIZE
+#    else
+// The SIO and PIO drivers read from the hardware FIFO, which is too shallow to hold them
+#        define SERIAL_USART_PIPELINE_BYTES 0
+#    endif
+#endif
+
 #if HAL_USE_SERIAL
 
 typedef SerialDriver QMKSerialDriver;
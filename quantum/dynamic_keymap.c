@@ -21,6 +21,8 @@
 #include "progmem.h"
 #include "send_string.h"
 #include "keycodes.h"
+#include "util.h"
+#include <string.h>
 
 #ifdef VIA_ENABLE
 #    include "via.h"
@@ -101,6 +103,14 @@ _Static_assert((DYNAMIC_KEYMAP_EEPROM_MAX_ADDR) - (DYNAMIC_KEYMAP_MACRO_EEPROM_A
 #    define DYNAMIC_KEYMAP_MACRO_DELAY TAP_CODE_DELAY
 #endif
 
+// Bumped on every change to the keymap, encoder map or macros so hosts can tell whether
+// their cached copy is still current. It lives in RAM and restarts from 0 on every boot.
+static uint16_t dynamic_keymap_generation = 0;
+
+uint16_t dynamic_keymap_get_generation(void) {
+    return dynamic_keymap_generation;
+}
+
 uint8_t dynamic_keymap_get_layer_count(void) {
     return DYNAMIC_KEYMAP_LAYER_COUNT;
 }
@@ -114,17 +124,18 @@ uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column)
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return KC_NO;
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
     // Big endian, so we can read/write EEPROM directly from host if we want
-    uint16_t keycode = eeprom_read_byte(address) << 8;
-    keycode |= eeprom_read_byte(address + 1);
-    return keycode;
+    uint8_t data[2];
+    eeprom_read_block(data, address, sizeof(data));
+    return (data[0] << 8) | data[1];
 }
 
 void dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return;
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
     // Big endian, so we can read/write EEPROM directly from host if we want
-    eeprom_update_byte(address, (uint8_t)(keycode >> 8));
-    eeprom_update_byte(address + 1, (uint8_t)(keycode & 0xFF));
+    uint8_t data[2] = {(uint8_t)(keycode >> 8), (uint8_t)(keycode & 0xFF)};
+    eeprom_update_block(data, address, sizeof(data));
+    dynamic_keymap_generation++;
 }
 
 #ifdef ENCODER_MAP_ENABLE
@@ -136,65 +147,82 @@ uint16_t dynamic_keymap_get_encoder(uint8_t layer, uint8_t encoder_id, bool cloc
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return KC_NO;
     void *address = dynamic_keymap_encoder_to_eeprom_address(layer, encoder_id);
     // Big endian, so we can read/write EEPROM directly from host if we want
-    uint16_t keycode = ((uint16_t)eeprom_read_byte(address + (clockwise ? 0 : 2))) << 8;
-    keycode |= eeprom_read_byte(address + (clockwise ? 0 : 2) + 1);
-    return keycode;
+    uint8_t data[2];
+    eeprom_read_block(data, address + (clockwise ? 0 : 2), sizeof(data));
+    return (data[0] << 8) | data[1];
 }
 
 void dynamic_keymap_set_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise, uint16_t keycode) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return;
     void *address = dynamic_keymap_encoder_to_eeprom_address(layer, encoder_id);
     // Big endian, so we can read/write EEPROM directly from host if we want
-    eeprom_update_byte(address + (clockwise ? 0 : 2), (uint8_t)(keycode >> 8));
-    eeprom_update_byte(address + (clockwise ? 0 : 2) + 1, (uint8_t)(keycode & 0xFF));
+    uint8_t data[2] = {(uint8_t)(keycode >> 8), (uint8_t)(keycode & 0xFF)};
+    eeprom_update_block(data, address + (clockwise ? 0 : 2), sizeof(data));
+    dynamic_keymap_generation++;
 }
 #endif // ENCODER_MAP_ENABLE
 
 void dynamic_keymap_reset(void) {
-    // Reset the keymaps in EEPROM to what is in flash.
+    // Reset the keymaps in EEPROM to what is in flash, a row at a time.
+    uint8_t row_data[MATRIX_COLS * 2];
+#ifdef ENCODER_MAP_ENABLE
+    uint8_t encoder_data[NUM_ENCODERS * 2 * 2];
+#endif // ENCODER_MAP_ENABLE
     for (int layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
         for (int row = 0; row < MATRIX_ROWS; row++) {
             for (int column = 0; column < MATRIX_COLS; column++) {
-                dynamic_keymap_set_keycode(layer, row, column, keycode_at_keymap_location_raw(layer, row, column));
+                uint16_t keycode         = keycode_at_keymap_location_raw(layer, row, column);
+                row_data[column * 2]     = (uint8_t)(keycode >> 8);
+                row_data[column * 2 + 1] = (uint8_t)(keycode & 0xFF);
             }
+            eeprom_update_block(row_data, dynamic_keymap_key_to_eeprom_address(layer, row, 0), sizeof(row_data));
         }
 #ifdef ENCODER_MAP_ENABLE
         for (int encoder = 0; encoder < NUM_ENCODERS; encoder++) {
-            dynamic_keymap_set_encoder(layer, encoder, true, keycode_at_encodermap_location_raw(layer, encoder, true));
-            dynamic_keymap_set_encoder(layer, encoder, false, keycode_at_encodermap_location_raw(layer, encoder, false));
+            uint16_t clockwise            = keycode_at_encodermap_location_raw(layer, encoder, true);
+            uint16_t counter_clockwise    = keycode_at_encodermap_location_raw(layer, encoder, false);
+            encoder_data[encoder * 4]     = (uint8_t)(clockwise >> 8);
+            encoder_data[encoder * 4 + 1] = (uint8_t)(clockwise & 0xFF);
+            encoder_data[encoder * 4 + 2] = (uint8_t)(counter_clockwise >> 8);
+            encoder_data[encoder * 4 + 3] = (uint8_t)(counter_clockwise & 0xFF);
         }
+        eeprom_update_block(encoder_data, dynamic_keymap_encoder_to_eeprom_address(layer, 0), sizeof(encoder_data));
 #endif // ENCODER_MAP_ENABLE
     }
+    dynamic_keymap_generation++;
+}
+
+// Clamps a host buffer request to the part that lies within a region of the given size
+static uint16_t dynamic_keymap_buffer_length(uint16_t offset, uint16_t size, uint16_t region_size) {
+    return offset < region_size ? MIN(size, region_size - offset) : 0;
 }
 
 void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void *   source                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
-    uint8_t *target                     = data;
-    for (uint16_t i = 0; i < size; i++) {
-        if (offset + i < dynamic_keymap_eeprom_size) {
-            *target = eeprom_read_byte(source);
-        } else {
-            *target = 0x00;
-        }
-        source++;
-        target++;
-    }
+    uint16_t length                     = dynamic_keymap_buffer_length(offset, size, dynamic_keymap_eeprom_size);
+    eeprom_read_block(data, (void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset), length);
+    memset(data + length, 0x00, size - length);
 }
 
 void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void *   target                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
-    uint8_t *source                     = data;
-    for (uint16_t i = 0; i < size; i++) {
-        if (offset + i < dynamic_keymap_eeprom_size) {
-            eeprom_update_byte(target, *source);
-        }
-        source++;
-        target++;
-    }
+    uint16_t length                     = dynamic_keymap_buffer_length(offset, size, dynamic_keymap_eeprom_size);
+    eeprom_update_block(data, (void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset), length);
+    dynamic_keymap_generation++;
 }
 
+#ifdef ENCODER_MAP_ENABLE
+uint16_t dynamic_keymap_encoder_get_buffer_size(void) {
+    return DYNAMIC_KEYMAP_LAYER_COUNT * NUM_ENCODERS * 2 * 2;
+}
+
+void dynamic_keymap_encoder_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
+    uint16_t length = dynamic_keymap_buffer_length(offset, size, dynamic_keymap_encoder_get_buffer_size());
+    eeprom_read_block(data, (void *)(uintptr_t)(DYNAMIC_KEYMAP_ENCODER_EEPROM_ADDR + offset), length);
+    memset(data + length, 0x00, size - length);
+}
+#endif // ENCODER_MAP_ENABLE
+
 uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column) {
     if (layer_num < DYNAMIC_KEYMAP_LAYER_COUNT && row < MATRIX_ROWS && column < MATRIX_COLS) {
         return dynamic_keymap_get_keycode(layer_num, row, column);
@@ -220,38 +248,24 @@ uint16_t dynamic_keymap_macro_get_buffer_size(void) {
 }
 
 void dynamic_keymap_macro_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    void *   source = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
-    uint8_t *target = data;
-    for (uint16_t i = 0; i < size; i++) {
-        if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
-            *target = eeprom_read_byte(source);
-        } else {
-            *target = 0x00;
-        }
-        source++;
-        target++;
-    }
+    uint16_t length = dynamic_keymap_buffer_length(offset, size, DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE);
+    eeprom_read_block(data, (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset), length);
+    memset(data + length, 0x00, size - length);
 }
 
 void dynamic_keymap_macro_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    void *   target = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
-    uint8_t *source = data;
-    for (uint16_t i = 0; i < size; i++) {
-        if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
-            eeprom_update_byte(target, *source);
-        }
-        source++;
-        target++;
-    }
+    uint16_t length = dynamic_keymap_buffer_length(offset, size, DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE);
+    eeprom_update_block(data, (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset), length);
+    dynamic_keymap_generation++;
 }
 
 void dynamic_keymap_macro_reset(void) {
-    void *p   = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR);
-    void *end = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE);
-    while (p != end) {
-        eeprom_update_byte(p, 0);
-        ++p;
+    static const uint8_t zeroes[32] = {0};
+    for (uint16_t offset = 0; offset < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE; offset += sizeof(zeroes)) {
+        uint16_t length = MIN(sizeof(zeroes), DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE - offset);
+        eeprom_update_block(zeroes, (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset), length);
     }
+    dynamic_keymap_generation++;
 }
 
 void dynamic_keymap_macro_send(uint8_t id) {
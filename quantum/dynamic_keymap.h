@@ -37,6 +37,15 @@ void dynamic_keymap_reset(void);
 // a factor of 14.
 void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data);
 void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data);
+#ifdef ENCODER_MAP_ENABLE
+// Same for the encoder map, ordered by layer/encoder, clockwise keycode first
+uint16_t dynamic_keymap_encoder_get_buffer_size(void);
+void     dynamic_keymap_encoder_get_buffer(uint16_t offset, uint16_t size, uint8_t *data);
+#endif // ENCODER_MAP_ENABLE
+
+// Incremented whenever the keymap, encoder map or macros are changed, starting from 0 at boot.
+// Host applications can compare it against the value they last synced at to skip a re-read.
+uint16_t dynamic_keymap_get_generation(void);
 
 // This overrides the one in quantum/keymap_common.c
 // uint16_t keymap_key_to_keycode(uint8_t layer, keypos_t key);
@@ -32,6 +32,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "sendchar.h"
 #include "eeconfig.h"
 #include "action_layer.h"
+#include "keyevent_queue.h"
 #ifdef BOOTMAGIC_ENABLE
 #    include "bootmagic.h"
 #endif
@@ -131,6 +132,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef LEADER_ENABLE
 #    include "leader.h"
 #endif
+#ifdef DYNAMIC_MACRO_ENABLE
+#    include "process_dynamic_macro.h"
+#endif
 #ifdef UNICODE_COMMON_ENABLE
 #    include "unicode.h"
 #endif
@@ -216,15 +220,26 @@ uint32_t get_matrix_scan_rate(void) {
 #    define matrix_scan_perf_task()
 #endif
 
+#if MATRIX_COLS > 16
+#    define matrix_row_ctz(rowdata) __builtin_ctzl(rowdata)
+#else
+#    define matrix_row_ctz(rowdata) __builtin_ctz(rowdata)
+#endif
+
 #ifdef MATRIX_HAS_GHOST
+// Real (non KC_NO) keys down on each row, refreshed once per changed scan
+static matrix_row_t ghost_real_keys[MATRIX_ROWS];
+
 static matrix_row_t get_real_keys(uint8_t row, matrix_row_t rowdata) {
     matrix_row_t out = 0;
-    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
-        // read each key in the row data and check if the keymap defines it as a real key
-        if (keycode_at_keymap_location(0, row, col) && (rowdata & (((matrix_row_t)1) << col))) {
-            // this creates new row data, if a key is defined in the keymap, it will be set here
+    // only the keys that are down need a keymap lookup
+    while (rowdata) {
+        const uint8_t col = matrix_row_ctz(rowdata);
+        // check if the keymap defines it as a real key, if so it will be set in the new row data
+        if (keycode_at_keymap_location(0, row, col)) {
             out |= ((matrix_row_t)1) << col;
         }
+        rowdata &= rowdata - 1;
     }
     return out;
 }
@@ -234,12 +249,21 @@ static inline bool popcount_more_than_one(matrix_row_t rowdata) {
     return rowdata;
 }
 
-static inline bool has_ghost_in_row(uint8_t row, matrix_row_t rowdata) {
+static void matrix_ghost_update(void) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        const matrix_row_t rowdata = matrix_get_row(row);
+        /* No ghost exists when less than 2 keys are down on the row,
+        so such rows are left empty and skip the keymap lookups. */
+        ghost_real_keys[row] = popcount_more_than_one(rowdata) ? get_real_keys(row, rowdata) : 0;
+    }
+}
+
+static inline bool has_ghost_in_row(uint8_t row) {
     /* No ghost exists when less than 2 keys are down on the row.
     If there are "active" blanks in the matrix, the key can't be pressed by the user,
     there is no doubt as to which keys are really being pressed.
     The ghosts will be ignored, they are KC_NO.   */
-    rowdata = get_real_keys(row, rowdata);
+    const matrix_row_t rowdata = ghost_real_keys[row];
     if ((popcount_more_than_one(rowdata)) == 0) {
         return false;
     }
@@ -251,7 +275,7 @@ static inline bool has_ghost_in_row(uint8_t row, matrix_row_t rowdata) {
     we are checking one row at a time, not all of them at once.
     */
     for (uint8_t i = 0; i < MATRIX_ROWS; i++) {
-        if (i != row && popcount_more_than_one(get_real_keys(i, matrix_get_row(i)) & rowdata)) {
+        if (i != row && popcount_more_than_one(ghost_real_keys[i] & rowdata)) {
             return true;
         }
     }
@@ -260,7 +284,9 @@ static inline bool has_ghost_in_row(uint8_t row, matrix_row_t rowdata) {
 
 #else
 
-static inline bool has_ghost_in_row(uint8_t row, matrix_row_t rowdata) {
+#    define matrix_ghost_update()
+
+static inline bool has_ghost_in_row(uint8_t row) {
     return false;
 }
 
@@ -520,63 +546,117 @@ static inline void generate_tick_event(void) {
     }
 }
 
+#if defined(MATRIX_SCAN_THREAD) && defined(SPLIT_KEYBOARD)
+#    error "MATRIX_SCAN_THREAD is not supported on split keyboards, the split transport runs as part of the matrix scan"
+#endif
+
+/* Key edges captured by the scan, waiting for the action pipeline. */
+static keyevent_queue_t keyevent_queue;
+
 /**
- * @brief This task scans the keyboards matrix and processes any key presses
- * that occur.
+ * @brief Scans the matrix and queues an event for every key that changed.
+ *
+ * All edges of a scan are queued with the time they were seen at before any
+ * of them is processed, so a slow handler doesn't skew the timestamps that
+ * tap-hold decisions are based on. With MATRIX_SCAN_THREAD this runs in its
+ * own thread, otherwise it is called from matrix_task().
  *
  * @return true Matrix did change
  * @return false Matrix didn't change
  */
-static bool matrix_task(void) {
-    if (!matrix_can_read()) {
-        generate_tick_event();
-        return false;
-    }
-
+bool matrix_scan_task(void) {
     static matrix_row_t matrix_previous[MATRIX_ROWS];
 
     matrix_scan();
+    matrix_scan_perf_task();
+
     bool matrix_changed = false;
-    for (uint8_t row = 0; row < MATRIX_ROWS && !matrix_changed; row++) {
-        matrix_changed |= matrix_previous[row] ^ matrix_get_row(row);
-    }
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        const matrix_row_t current_row = matrix_get_row(row);
+        matrix_row_t       row_changes = current_row ^ matrix_previous[row];
 
-    matrix_scan_perf_task();
+        // Short-circuit the row processing if it is not necessary
+        if (!row_changes) {
+            continue;
+        }
 
-    // Short-circuit the complete matrix processing if it is not necessary
-    if (!matrix_changed) {
-        generate_tick_event();
-        return matrix_changed;
-    }
+        if (!matrix_changed) {
+            matrix_changed = true;
+            if (debug_config.matrix) {
+                matrix_print();
+            }
+            matrix_ghost_update();
+        }
 
-    if (debug_config.matrix) {
-        matrix_print();
+        if (has_ghost_in_row(row)) {
+            continue;
+        }
+
+        // Visit only the changed columns, lowest first
+        while (row_changes) {
+            const uint8_t      col      = matrix_row_ctz(row_changes);
+            const matrix_row_t col_mask = ((matrix_row_t)1) << col;
+            // If the queue is full, the edge is picked up again by the next scan
+            if (!keyevent_queue_push(&keyevent_queue, MAKE_KEYEVENT(row, col, current_row & col_mask))) {
+                return matrix_changed;
+            }
+            matrix_previous[row] ^= col_mask;
+            row_changes &= row_changes - 1;
+        }
     }
 
+    return matrix_changed;
+}
+
+/**
+ * @brief Hands all queued key events to the action pipeline.
+ *
+ * @return true Any key event was processed
+ * @return false The queue was empty
+ */
+static bool keyevent_queue_task(void) {
     const bool process_keypress = should_process_keypress();
+    bool       has_events       = false;
+    keyevent_t event;
 
-    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
-        const matrix_row_t current_row = matrix_get_row(row);
-        const matrix_row_t row_changes = current_row ^ matrix_previous[row];
+    while (keyevent_queue_pop(&keyevent_queue, &event)) {
+        has_events = true;
 
-        if (!row_changes || has_ghost_in_row(row, current_row)) {
-            continue;
+        if (process_keypress) {
+            action_exec(event);
         }
 
-        matrix_row_t col_mask = 1;
-        for (uint8_t col = 0; col < MATRIX_COLS; col++, col_mask <<= 1) {
-            if (row_changes & col_mask) {
-                const bool key_pressed = current_row & col_mask;
+        switch_events(event.key.row, event.key.col, event.pressed);
+    }
 
-                if (process_keypress) {
-                    action_exec(MAKE_KEYEVENT(row, col, key_pressed));
-                }
+    return has_events;
+}
 
-                switch_events(row, col, key_pressed);
-            }
-        }
+/**
+ * @brief This task scans the keyboards matrix and processes any key presses
+ * that occur.
+ *
+ * Changes that queue no key event, such as keys in a ghosted row, don't count
+ * as activity. With MATRIX_SCAN_THREAD the events can come from several scans
+ * of the thread.
+ *
+ * @return true Key events were processed
+ * @return false No key event was processed, a tick event was generated instead
+ */
+static bool matrix_task(void) {
+#ifndef MATRIX_SCAN_THREAD
+    if (!matrix_can_read()) {
+        generate_tick_event();
+        return false;
+    }
+
+    matrix_scan_task();
+#endif
+
+    const bool matrix_changed = keyevent_queue_task();
 
-        matrix_previous[row] = current_row;
+    if (!matrix_changed) {
+        generate_tick_event();
     }
 
     return matrix_changed;
@@ -636,6 +716,10 @@ void quantum_task(void) {
     leader_task();
 #endif
 
+#ifdef DYNAMIC_MACRO_ENABLE
+    dynamic_macro_task();
+#endif
+
 #ifdef WPM_ENABLE
     decay_wpm();
 #endif
@@ -660,6 +744,7 @@ void quantum_task(void) {
 /** \brief Main task that is repeatedly called as fast as possible. */
 void keyboard_task(void) {
     __attribute__((unused)) bool activity_has_occurred = false;
+    // Key events count as matrix activity, not every change of the raw matrix
     if (matrix_task()) {
         last_matrix_activity_trigger();
         activity_has_occurred = true;
@@ -109,6 +109,8 @@ void keyboard_setup(void);
 void keyboard_init(void);
 /* it runs repeatedly in main loop */
 void keyboard_task(void);
+/* it scans the matrix and queues the changes, see MATRIX_SCAN_THREAD */
+bool matrix_scan_task(void);
 /* it runs whenever code has to behave differently on a slave */
 bool is_keyboard_master(void);
 /* it runs whenever code has to behave differently on left vs right split */
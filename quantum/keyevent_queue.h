@@ -0,0 +1,65 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "keyboard.h"
+
+/* Queue of key events between the matrix scan and the action pipeline.
+ *
+ * The queue has a single producer, which captures edges together with their
+ * scan time, and a single consumer, which hands them to action_exec(). The
+ * producer only ever writes `head` and the consumer only ever writes `tail`,
+ * so it is safe to fill the queue from an interrupt or another thread
+ * without locking.
+ */
+
+#ifndef KEYEVENT_QUEUE_SIZE
+#    define KEYEVENT_QUEUE_SIZE 16
+#endif
+
+_Static_assert(KEYEVENT_QUEUE_SIZE <= 128 && (KEYEVENT_QUEUE_SIZE & (KEYEVENT_QUEUE_SIZE - 1)) == 0, "KEYEVENT_QUEUE_SIZE must be a power of two no larger than 128");
+
+typedef struct {
+    keyevent_t events[KEYEVENT_QUEUE_SIZE];
+    uint8_t    head;
+    uint8_t    tail;
+} keyevent_queue_t;
+
+/**
+ * \brief Append an event to the queue. Producer side only.
+ *
+ * \return `false` if the queue is full.
+ */
+static inline bool keyevent_queue_push(keyevent_queue_t *queue, keyevent_t event) {
+    uint8_t head = __atomic_load_n(&queue->head, __ATOMIC_RELAXED);
+    uint8_t tail = __atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE);
+
+    if ((uint8_t)(head - tail) >= KEYEVENT_QUEUE_SIZE) {
+        return false;
+    }
+
+    queue->events[head % KEYEVENT_QUEUE_SIZE] = event;
+    __atomic_store_n(&queue->head, (uint8_t)(head + 1), __ATOMIC_RELEASE);
+    return true;
+}
+
+/**
+ * \brief Take the oldest event from the queue. Consumer side only.
+ *
+ * \return `false` if the queue is empty.
+ */
+static inline bool keyevent_queue_pop(keyevent_queue_t *queue, keyevent_t *event) {
+    uint8_t tail = __atomic_load_n(&queue->tail, __ATOMIC_RELAXED);
+    uint8_t head = __atomic_load_n(&queue->head, __ATOMIC_ACQUIRE);
+
+    if (head == tail) {
+        return false;
+    }
+
+    *event = queue->events[tail % KEYEVENT_QUEUE_SIZE];
+    __atomic_store_n(&queue->tail, (uint8_t)(tail + 1), __ATOMIC_RELEASE);
+    return true;
+}
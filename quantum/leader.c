@@ -7,6 +7,14 @@
 
 #include <string.h>
 
+#if __has_include("leader_data.h")
+#    include "keycodes.h"
+#    include "progmem.h"
+#    define LEADER_DATA_IMPLEMENTATION
+#    include "leader_data.h"
+#    define LEADER_TRIE_ENABLE
+#endif
+
 #ifndef LEADER_TIMEOUT
 #    define LEADER_TIMEOUT 300
 #endif
@@ -17,6 +25,40 @@ uint16_t leader_time          = 0;
 uint16_t leader_sequence[5]   = {0, 0, 0, 0, 0};
 uint8_t  leader_sequence_size = 0;
 
+#ifdef LEADER_TRIE_ENABLE
+#    define LEADER_TRIE_LEAF 0x8000
+#    define LEADER_TRIE_DEAD_END 0xFFFF
+
+// Offset of the trie node reached by the keys so far
+static uint16_t leader_trie_cursor = 0;
+
+/**
+ * \brief Advance the trie cursor by one keycode.
+ *
+ * Each node is a header word (child count in the low byte, LEADER_TRIE_LEAF
+ * if a sequence ends here), the sequence index if it is a leaf, then one
+ * (keycode, node offset) pair per child.
+ *
+ * \return `true` if the sequence can no longer change: either a leaf without
+ *         children was reached or no sequence starts with the keys so far.
+ */
+static bool leader_trie_advance(uint16_t keycode) {
+    uint16_t node     = leader_trie_cursor;
+    uint16_t header   = pgm_read_word(&leader_trie[node]);
+    uint8_t  children = header & 0xFF;
+    uint16_t child    = node + 1 + ((header & LEADER_TRIE_LEAF) ? 1 : 0);
+
+    leader_trie_cursor = LEADER_TRIE_DEAD_END;
+    for (uint8_t i = 0; i < children; i++, child += 2) {
+        if (pgm_read_word(&leader_trie[child]) == keycode) {
+            leader_trie_cursor = pgm_read_word(&leader_trie[child + 1]);
+            return (pgm_read_word(&leader_trie[leader_trie_cursor]) & 0xFF) == 0;
+        }
+    }
+    return true;
+}
+#endif
+
 __attribute__((weak)) void leader_start_user(void) {}
 
 __attribute__((weak)) void leader_end_user(void) {}
@@ -30,6 +72,9 @@ void leader_start(void) {
     leader_time          = timer_read();
     leader_sequence_size = 0;
     memset(leader_sequence, 0, sizeof(leader_sequence));
+#ifdef LEADER_TRIE_ENABLE
+    leader_trie_cursor = 0;
+#endif
 }
 
 void leader_end(void) {
@@ -61,6 +106,13 @@ bool leader_sequence_add(uint16_t keycode) {
     leader_sequence[leader_sequence_size] = keycode;
     leader_sequence_size++;
 
+#ifdef LEADER_TRIE_ENABLE
+    // No need to wait for the timeout once the outcome is known
+    if (leader_trie_advance(keycode)) {
+        leader_end();
+    }
+#endif
+
     return true;
 }
 
@@ -76,6 +128,18 @@ void leader_reset_timer(void) {
     leader_time = timer_read();
 }
 
+uint8_t leader_sequence_match(void) {
+#ifdef LEADER_TRIE_ENABLE
+    if (leader_trie_cursor != LEADER_TRIE_DEAD_END && leader_sequence_size > 0) {
+        uint16_t header = pgm_read_word(&leader_trie[leader_trie_cursor]);
+        if (header & LEADER_TRIE_LEAF) {
+            return pgm_read_word(&leader_trie[leader_trie_cursor + 1]);
+        }
+    }
+#endif
+    return LEADER_NO_MATCH;
+}
+
 bool leader_sequence_is(uint16_t kc1, uint16_t kc2, uint16_t kc3, uint16_t kc4, uint16_t kc5) {
     return leader_sequence[0] == kc1 && leader_sequence[1] == kc2 && leader_sequence[2] == kc3 && leader_sequence[3] == kc4 && leader_sequence[4] == kc5;
 }
@@ -61,6 +61,16 @@ bool leader_sequence_timed_out(void);
  */
 void leader_reset_timer(void);
 
+#define LEADER_NO_MATCH 0xFF
+
+/**
+ * Look up the sequence buffer in the sequences generated into `leader_data.h`.
+ *
+ * \return The index of the matching sequence, or `LEADER_NO_MATCH` if there is
+ *         none or no `leader_data.h` was found.
+ */
+uint8_t leader_sequence_match(void);
+
 /**
  * Check the sequence buffer for the given keycode.
  *
@@ -104,6 +104,90 @@ static inline uint8_t readMatrixPin(pin_t pin) {
     }
 }
 
+#ifdef MATRIX_PORT_SCAN
+#    if defined(DIRECT_PINS) || !defined(MATRIX_ROW_PINS) || !defined(MATRIX_COL_PINS)
+#        error "MATRIX_PORT_SCAN requires MATRIX_ROW_PINS and MATRIX_COL_PINS"
+#    endif
+#    ifndef gpio_read_port
+#        error "MATRIX_PORT_SCAN is not supported on this platform"
+#    endif
+
+#    if (DIODE_DIRECTION == COL2ROW)
+#        define MATRIX_PORT_PINS MATRIX_COLS
+#    else
+#        define MATRIX_PORT_PINS ROWS_PER_HAND
+#    endif
+
+#    if MATRIX_PORT_PINS > 32
+#        error "MATRIX_PORT_SCAN supports at most 32 input pins"
+#    elif MATRIX_PORT_PINS > 16
+typedef uint32_t matrix_port_bits_t;
+#    elif MATRIX_PORT_PINS > 8
+typedef uint16_t matrix_port_bits_t;
+#    else
+typedef uint8_t matrix_port_bits_t;
+#    endif
+
+// A run of input pins with consecutive bits on one port, which land on consecutive matrix bits
+typedef struct {
+    pin_t       pin;    // first pin of the run, used to read its port
+    port_data_t mask;   // bits of the run, shifted down to bit 0
+    uint8_t     shift;  // port bit of the first pin of the run
+    uint8_t     offset; // matrix bit of the first pin of the run
+    bool        read;   // first run on its port, which is read before the run is extracted
+} matrix_port_run_t;
+
+static matrix_port_run_t matrix_port_runs[MATRIX_PORT_PINS];
+static uint8_t           matrix_port_run_count;
+
+static void matrix_init_port_runs(const pin_t pins[]) {
+    bool grouped[MATRIX_PORT_PINS] = {false};
+
+    matrix_port_run_count = 0;
+    for (uint8_t i = 0; i < MATRIX_PORT_PINS; i++) {
+        if (pins[i] == NO_PIN || grouped[i]) {
+            continue;
+        }
+
+        // Gather all the pins on the same port, so that the port is read only once
+        matrix_port_run_t *run = NULL;
+        for (uint8_t j = i; j < MATRIX_PORT_PINS; j++) {
+            if (pins[j] == NO_PIN || grouped[j] || gpio_pin_port(pins[j]) != gpio_pin_port(pins[i])) {
+                continue;
+            }
+            grouped[j] = true;
+
+            // Extend the current run if both the port bit and the matrix bit follow on from it
+            const uint8_t bit = gpio_pin_bit(pins[j]);
+            if (run != NULL && bit == run->shift + (j - run->offset) && run->mask + 1 == ((port_data_t)1 << (j - run->offset))) {
+                run->mask |= (port_data_t)1 << (j - run->offset);
+            } else {
+                run  = &matrix_port_runs[matrix_port_run_count++];
+                *run = (matrix_port_run_t){.pin = pins[j], .mask = 1, .shift = bit, .offset = j, .read = (j == i)};
+            }
+        }
+    }
+}
+
+static matrix_port_bits_t matrix_read_port_runs(void) {
+    matrix_port_bits_t out   = 0;
+    port_data_t        value = 0;
+
+    for (uint8_t i = 0; i < matrix_port_run_count; i++) {
+        const matrix_port_run_t *run = &matrix_port_runs[i];
+        if (run->read) {
+#    if MATRIX_INPUT_PRESSED_STATE == 0
+            value = ~gpio_read_port(run->pin);
+#    else
+            value = gpio_read_port(run->pin);
+#    endif
+        }
+        out |= (matrix_port_bits_t)((value >> run->shift) & run->mask) << run->offset;
+    }
+    return out;
+}
+#endif
+
 // matrix code
 
 #ifdef DIRECT_PINS
@@ -181,6 +265,10 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
     }
     matrix_output_select_delay();
 
+#            ifdef MATRIX_PORT_SCAN
+    // Read every col at once, one port read per port in use
+    current_row_value = matrix_read_port_runs();
+#            else
     // For each col...
     matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
     for (uint8_t col_index = 0; col_index < MATRIX_COLS; col_index++, row_shifter <<= 1) {
@@ -189,6 +277,7 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
         // Populate the matrix row with the state of the col pin
         current_row_value |= pin_state ? 0 : row_shifter;
     }
+#            endif
 
     // Unselect row
     unselect_row(current_row);
@@ -244,10 +333,19 @@ __attribute__((weak)) void matrix_read_rows_on_col(matrix_row_t current_matrix[]
     }
     matrix_output_select_delay();
 
+#            ifdef MATRIX_PORT_SCAN
+    // Read every row at once, one port read per port in use
+    const matrix_port_bits_t rows = matrix_read_port_runs();
+#            endif
+
     // For each row...
     for (uint8_t row_index = 0; row_index < ROWS_PER_HAND; row_index++) {
         // Check row pin state
+#            ifdef MATRIX_PORT_SCAN
+        if (rows & ((matrix_port_bits_t)1 << row_index)) {
+#            else
         if (readMatrixPin(row_pins[row_index]) == 0) {
+#            endif
             // Pin LO, set col bit
             current_matrix[row_index] |= row_shifter;
             key_pressed = true;
@@ -300,6 +398,15 @@ void matrix_init(void) {
     thatHand = ROWS_PER_HAND - thisHand;
 #endif
 
+#ifdef MATRIX_PORT_SCAN
+    // group the input pins by port, once the pins for this half are known
+#    if (DIODE_DIRECTION == COL2ROW)
+    matrix_init_port_runs(col_pins);
+#    else
+    matrix_init_port_runs(row_pins);
+#    endif
+#endif
+
     // initialize key pins
     matrix_init_pins();
 
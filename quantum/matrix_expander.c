@@ -0,0 +1,305 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*
+ * Matrix backend for keyboards whose matrix sits behind an I/O expander or shift registers,
+ * used together with `CUSTOM_MATRIX = lite`. Rows are selected by driving them low, columns
+ * are read with pull-ups, so a pressed key reads as 0.
+ *
+ * Every bus transfer reads the columns of the currently selected row and then selects the
+ * next one. On shift registers that is a single full-duplex SPI transfer per row. While no
+ * key is down every row is left selected, so a single read (or nothing at all, when the
+ * expander interrupt line is wired up) is enough to tell that the matrix is still idle.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "matrix.h"
+#include "timer.h"
+#include "wait.h"
+#include "debug.h"
+
+#ifdef SPLIT_KEYBOARD
+#    define ROWS_PER_HAND (MATRIX_ROWS / 2)
+#else
+#    define ROWS_PER_HAND (MATRIX_ROWS)
+#endif
+
+#ifndef MATRIX_EXPANDER_RETRY_MS
+#    define MATRIX_EXPANDER_RETRY_MS 1000
+#endif
+
+#if ROWS_PER_HAND > 16
+typedef uint32_t expander_rows_t;
+#elif ROWS_PER_HAND > 8
+typedef uint16_t expander_rows_t;
+#else
+typedef uint8_t expander_rows_t;
+#endif
+
+#define EXPANDER_ROW(row) (((expander_rows_t)1) << (row))
+#define EXPANDER_ALL_ROWS ((expander_rows_t)(((uint64_t)1 << ROWS_PER_HAND) - 1))
+#define EXPANDER_COLS_MASK ((matrix_row_t)(((uint64_t)1 << MATRIX_COLS) - 1))
+
+#if defined(MATRIX_EXPANDER_MCP23018) || defined(MATRIX_EXPANDER_PCA9555)
+#    if ROWS_PER_HAND > 8 || MATRIX_COLS > 8
+#        error "The I2C expander matrix supports up to 8 rows and 8 columns"
+#    endif
+#    ifndef MATRIX_EXPANDER_I2C_ADDRESS
+#        define MATRIX_EXPANDER_I2C_ADDRESS 0x20
+#    endif
+#endif
+
+#if defined(MATRIX_EXPANDER_MCP23018)
+#    include "mcp23018.h"
+
+// Columns are on port A, rows on port B, pin n being column/row n
+static bool expander_init(void) {
+    mcp23018_init(MATRIX_EXPANDER_I2C_ADDRESS);
+    if (!mcp23018_set_config(MATRIX_EXPANDER_I2C_ADDRESS, mcp23018_PORTA, ALL_INPUT)) {
+        return false;
+    }
+    if (!mcp23018_set_config(MATRIX_EXPANDER_I2C_ADDRESS, mcp23018_PORTB, ALL_OUTPUT)) {
+        return false;
+    }
+#    ifdef MATRIX_EXPANDER_INT_PIN
+    // INTA follows the columns, it is cleared by reading them
+    if (!mcp23018_set_interrupt(MATRIX_EXPANDER_I2C_ADDRESS, mcp23018_PORTA, ALL_INPUT)) {
+        return false;
+    }
+#    endif
+    return true;
+}
+
+static bool expander_read_cols(uint8_t *data) {
+    return mcp23018_read_pins(MATRIX_EXPANDER_I2C_ADDRESS, mcp23018_PORTA, data);
+}
+
+static bool expander_select_rows(expander_rows_t rows) {
+    return mcp23018_set_output(MATRIX_EXPANDER_I2C_ADDRESS, mcp23018_PORTB, ~rows);
+}
+
+#elif defined(MATRIX_EXPANDER_PCA9555)
+#    include "pca9555.h"
+
+// Columns are on port 0 with external pull-ups, rows on port 1, pin n being column/row n
+static bool expander_init(void) {
+    pca9555_init(MATRIX_EXPANDER_I2C_ADDRESS);
+    if (!pca9555_set_config(MATRIX_EXPANDER_I2C_ADDRESS, PCA9555_PORT0, ALL_INPUT)) {
+        return false;
+    }
+    // The PCA9555 interrupt line needs no setup, it asserts on any input change since the last read
+    return pca9555_set_config(MATRIX_EXPANDER_I2C_ADDRESS, PCA9555_PORT1, ALL_OUTPUT);
+}
+
+static bool expander_read_cols(uint8_t *data) {
+    return pca9555_read_pins(MATRIX_EXPANDER_I2C_ADDRESS, PCA9555_PORT0, data);
+}
+
+static bool expander_select_rows(expander_rows_t rows) {
+    return pca9555_set_output(MATRIX_EXPANDER_I2C_ADDRESS, PCA9555_PORT1, ~rows);
+}
+
+#elif defined(MATRIX_EXPANDER_SHIFT_REGISTER)
+#    include "gpio.h"
+#    include "spi_master.h"
+
+#    ifndef MATRIX_SHIFT_REGISTER_LATCH_PIN
+#        error "MATRIX_SHIFT_REGISTER_LATCH_PIN (74HC595 RCLK) must be defined"
+#    endif
+#    ifndef MATRIX_SHIFT_REGISTER_LOAD_PIN
+#        error "MATRIX_SHIFT_REGISTER_LOAD_PIN (74HC165 SH/LD) must be defined"
+#    endif
+#    ifdef MATRIX_EXPANDER_INT_PIN
+#        error "MATRIX_EXPANDER_INT_PIN is not supported with shift registers"
+#    endif
+#    ifndef MATRIX_SHIFT_REGISTER_SPI_MODE
+#        define MATRIX_SHIFT_REGISTER_SPI_MODE 0
+#    endif
+#    ifndef MATRIX_SHIFT_REGISTER_SPI_DIVISOR
+#        define MATRIX_SHIFT_REGISTER_SPI_DIVISOR 8
+#    endif
+
+#    define SHIFT_REGISTER_ROW_BYTES ((ROWS_PER_HAND + 7) / 8)
+#    define SHIFT_REGISTER_COL_BYTES ((MATRIX_COLS + 7) / 8)
+#    if SHIFT_REGISTER_ROW_BYTES > SHIFT_REGISTER_COL_BYTES
+#        define SHIFT_REGISTER_BYTES SHIFT_REGISTER_ROW_BYTES
+#    else
+#        define SHIFT_REGISTER_BYTES SHIFT_REGISTER_COL_BYTES
+#    endif
+
+static bool expander_init(void) {
+    spi_init();
+    gpio_set_pin_output(MATRIX_SHIFT_REGISTER_LOAD_PIN);
+    gpio_write_pin_high(MATRIX_SHIFT_REGISTER_LOAD_PIN);
+    return true;
+}
+#else
+#    error "No matrix expander driver selected, set MATRIX_EXPANDER_DRIVER in rules.mk"
+#endif
+
+static bool            expander_ready = false;
+static uint16_t        expander_retry_timer;
+static expander_rows_t expander_selected;
+
+/**
+ * @brief Reads the columns of the selected rows, then selects the given rows.
+ *
+ * @param cols receives the pressed columns, or NULL when the read can be skipped
+ * @param rows the rows to drive for the next transfer
+ */
+static bool expander_transfer(matrix_row_t *cols, expander_rows_t rows) {
+#if defined(MATRIX_EXPANDER_SHIFT_REGISTER)
+    uint8_t data[SHIFT_REGISTER_BYTES];
+
+    if (cols) {
+        matrix_output_select_delay();
+    }
+
+    // Capture the columns, then shift them in while the next row selection is shifted out
+    gpio_write_pin_low(MATRIX_SHIFT_REGISTER_LOAD_PIN);
+    gpio_write_pin_high(MATRIX_SHIFT_REGISTER_LOAD_PIN);
+
+    // The latch pin doubles as chip select, its rising edge on spi_stop() latches the rows
+    if (!spi_start(MATRIX_SHIFT_REGISTER_LATCH_PIN, false, MATRIX_SHIFT_REGISTER_SPI_MODE, MATRIX_SHIFT_REGISTER_SPI_DIVISOR)) {
+        return false;
+    }
+    for (uint8_t i = 0; i < SHIFT_REGISTER_BYTES; i++) {
+        // The 74HC595 nearest to the MCU holds rows 0-7 and receives the last byte
+        const uint8_t byte = SHIFT_REGISTER_BYTES - 1 - i;
+        const uint8_t out  = byte < SHIFT_REGISTER_ROW_BYTES ? ~(uint8_t)((uint32_t)rows >> (byte * 8)) : 0xFF;
+
+        spi_status_t in = spi_write(out);
+        if (in < 0) {
+            spi_stop();
+            return false;
+        }
+        data[i] = (uint8_t)in;
+    }
+    spi_stop();
+    expander_selected = rows;
+
+    if (cols) {
+        // The 74HC165 wired to MISO holds columns 0-7 and is read first, input H being column 7
+        matrix_row_t value = 0;
+        for (uint8_t i = 0; i < SHIFT_REGISTER_COL_BYTES; i++) {
+            value |= (matrix_row_t)data[i] << (i * 8);
+        }
+        *cols = ~value & EXPANDER_COLS_MASK;
+    }
+#else
+    if (cols) {
+        uint8_t data;
+        if (!expander_read_cols(&data)) {
+            return false;
+        }
+        *cols = (matrix_row_t)~data & EXPANDER_COLS_MASK;
+    }
+
+    // Selecting the next row replaces the previous selection, nothing needs unselecting
+    if (rows != expander_selected) {
+        if (!expander_select_rows(rows)) {
+            return false;
+        }
+        expander_selected = rows;
+    }
+#endif
+    return true;
+}
+
+static bool expander_setup(void) {
+    if (!expander_init()) {
+        return false;
+    }
+    // Start out idle, with every row selected
+    expander_selected = 0;
+    return expander_transfer(NULL, EXPANDER_ALL_ROWS);
+}
+
+/**
+ * @brief Drops the expander after a failed transfer and releases every key behind it, so
+ * nothing stays held while it is gone. Keys down on reconnect are pressed again.
+ *
+ * @return true the cleared rows are always reported as a change
+ */
+static bool expander_failed(matrix_row_t current_matrix[]) {
+    dprintf("matrix_expander: transfer failed\n");
+    expander_ready       = false;
+    expander_retry_timer = timer_read();
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        current_matrix[row] = 0;
+    }
+    return true;
+}
+
+void matrix_init_custom(void) {
+#ifdef MATRIX_EXPANDER_INT_PIN
+    gpio_set_pin_input_high(MATRIX_EXPANDER_INT_PIN);
+#endif
+    expander_ready       = expander_setup();
+    expander_retry_timer = timer_read();
+}
+
+bool matrix_scan_custom(matrix_row_t current_matrix[]) {
+    if (!expander_ready) {
+        if (timer_elapsed(expander_retry_timer) < MATRIX_EXPANDER_RETRY_MS) {
+            return false;
+        }
+        expander_retry_timer = timer_read();
+        if (!(expander_ready = expander_setup())) {
+            dprintf("matrix_expander: setup failed\n");
+            return false;
+        }
+    }
+
+    bool idle = true;
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        idle &= !current_matrix[row];
+    }
+
+    matrix_row_t cols;
+#ifndef MATRIX_EXPANDER_NO_IDLE_PROBE
+    if (idle && expander_selected == EXPANDER_ALL_ROWS) {
+#    ifdef MATRIX_EXPANDER_INT_PIN
+        // The interrupt line stays released until a column changes
+        if (gpio_read_pin(MATRIX_EXPANDER_INT_PIN)) {
+            return false;
+        }
+#    endif
+        if (!expander_transfer(&cols, EXPANDER_ALL_ROWS)) {
+            return expander_failed(current_matrix);
+        }
+        if (!cols) {
+            return false;
+        }
+    }
+#endif
+
+    if (expander_selected != EXPANDER_ROW(0) && !expander_transfer(NULL, EXPANDER_ROW(0))) {
+        return expander_failed(current_matrix);
+    }
+
+    bool changed = false;
+    idle         = true;
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        expander_rows_t next = EXPANDER_ROW(0);
+        if (row + 1 < ROWS_PER_HAND) {
+            next = EXPANDER_ROW(row + 1);
+#ifndef MATRIX_EXPANDER_NO_IDLE_PROBE
+        } else if (idle) {
+            // Nothing down so far, go back to idle; a key on the last row reselects row 0 next scan
+            next = EXPANDER_ALL_ROWS;
+#endif
+        }
+
+        if (!expander_transfer(&cols, next)) {
+            return expander_failed(current_matrix);
+        }
+
+        idle &= !cols;
+        changed |= current_matrix[row] != cols;
+        current_matrix[row] = cols;
+    }
+
+    return changed;
+}
@@ -42,15 +42,65 @@
 report_mouse_t shared_mouse_report = {};
 uint16_t       shared_cpi          = 0;
 
+// Motion received from the other side that has not been handed to a report yet
+static struct {
+    int16_t x;
+    int16_t y;
+    int16_t h;
+    int16_t v;
+} shared_carry = {0};
+
+static inline int16_t pointing_device_add_saturated(int16_t carry, int16_t delta) {
+    int32_t sum = (int32_t)carry + delta;
+    return sum > INT16_MAX ? INT16_MAX : sum < INT16_MIN ? INT16_MIN : (int16_t)sum;
+}
+
+static inline int16_t pointing_device_take_carry(int16_t *carry, int16_t min, int16_t max) {
+    int16_t value = *carry > max ? max : *carry < min ? min : *carry;
+    *carry -= value;
+    return value;
+}
+
 /**
  * @brief Sets the shared mouse report used be pointing device task
  *
+ * The motion replaces whatever was received from the other side and not sent yet.
+ *
  * NOTE : Only available when using SPLIT_POINTING_ENABLE
  *
  * @param[in] new_mouse_report report_mouse_t
  */
 void pointing_device_set_shared_report(report_mouse_t new_mouse_report) {
     shared_mouse_report = new_mouse_report;
+    shared_carry.x      = new_mouse_report.x;
+    shared_carry.y      = new_mouse_report.y;
+    shared_carry.h      = new_mouse_report.h;
+    shared_carry.v      = new_mouse_report.v;
+}
+
+/**
+ * @brief Adds motion received from the other side to the shared mouse report
+ *
+ * Motion that does not fit a single report carries over to the next ones.
+ *
+ * NOTE : Only available when using SPLIT_POINTING_ENABLE
+ */
+void pointing_device_add_shared_motion(int16_t x, int16_t y, int16_t h, int16_t v, uint8_t buttons) {
+    shared_carry.x              = pointing_device_add_saturated(shared_carry.x, x);
+    shared_carry.y              = pointing_device_add_saturated(shared_carry.y, y);
+    shared_carry.h              = pointing_device_add_saturated(shared_carry.h, h);
+    shared_carry.v              = pointing_device_add_saturated(shared_carry.v, v);
+    shared_mouse_report.buttons = buttons;
+}
+
+/**
+ * @brief Moves as much of the received motion into the shared mouse report as it can hold
+ */
+static void pointing_device_take_shared_report(void) {
+    shared_mouse_report.x = pointing_device_take_carry(&shared_carry.x, XY_REPORT_MIN, XY_REPORT_MAX);
+    shared_mouse_report.y = pointing_device_take_carry(&shared_carry.y, XY_REPORT_MIN, XY_REPORT_MAX);
+    shared_mouse_report.h = pointing_device_take_carry(&shared_carry.h, INT8_MIN, INT8_MAX);
+    shared_mouse_report.v = pointing_device_take_carry(&shared_carry.v, INT8_MIN, INT8_MAX);
 }
 
 /**
@@ -76,11 +126,51 @@ uint16_t pointing_device_get_shared_cpi(void) {
 
 #endif // defined(SPLIT_POINTING_ENABLE)
 
+/**
+ * @brief Checks whether the sensor on this side has motion to report
+ *
+ * @return true if POINTING_DEVICE_MOTION_PIN is active, or not used
+ */
+bool pointing_device_motion_detected(void) {
+#if defined(POINTING_DEVICE_MOTION_PIN) && defined(POINTING_DEVICE_MOTION_PIN_ACTIVE_LOW)
+    return !gpio_read_pin(POINTING_DEVICE_MOTION_PIN);
+#elif defined(POINTING_DEVICE_MOTION_PIN)
+    return gpio_read_pin(POINTING_DEVICE_MOTION_PIN);
+#else
+    return true;
+#endif
+}
+
 static report_mouse_t local_mouse_report         = {};
 static bool           pointing_device_force_send = false;
 
 extern const pointing_device_driver_t pointing_device_driver;
 
+#if defined(SPLIT_POINTING_ENABLE)
+/**
+ * @brief Polls the sensor on this side and adds its motion to the running totals
+ *
+ * Used on the slave side, which can poll at the full sensor rate while the master picks the
+ * totals up whenever the link gets to it.
+ *
+ * NOTE : Only available when using SPLIT_POINTING_ENABLE
+ *
+ * @param[in,out] motion running totals
+ */
+void pointing_device_accumulate_motion(pointing_device_motion_t *motion) {
+    if (!pointing_device_motion_detected()) {
+        return;
+    }
+
+    report_mouse_t report = pointing_device_driver.get_report((report_mouse_t){0});
+    motion->x += (uint16_t)report.x;
+    motion->y += (uint16_t)report.y;
+    motion->h += (uint16_t)report.h;
+    motion->v += (uint16_t)report.v;
+    motion->buttons = report.buttons;
+}
+#endif // defined(SPLIT_POINTING_ENABLE)
+
 /**
  * @brief Keyboard level code pointing device initialisation
  *
@@ -241,37 +331,30 @@ __attribute__((weak)) bool pointing_device_task(void) {
     last_exec = timer_read32();
 #endif
 
-    // Gather report info
-#ifdef POINTING_DEVICE_MOTION_PIN
-#    if defined(SPLIT_POINTING_ENABLE)
-#        error POINTING_DEVICE_MOTION_PIN not supported when sharing the pointing device report between sides.
-#    endif
-#    ifdef POINTING_DEVICE_MOTION_PIN_ACTIVE_LOW
-    if (!gpio_read_pin(POINTING_DEVICE_MOTION_PIN))
-#    else
-    if (gpio_read_pin(POINTING_DEVICE_MOTION_PIN))
-#    endif
-    {
-#endif
-
+    // Gather report info, the motion pin only gates the sensor on this side
 #if defined(SPLIT_POINTING_ENABLE)
+    pointing_device_take_shared_report();
 #    if defined(POINTING_DEVICE_COMBINED)
-        static uint8_t old_buttons = 0;
-        local_mouse_report.buttons = old_buttons;
-        local_mouse_report         = pointing_device_driver.get_report(local_mouse_report);
-        old_buttons                = local_mouse_report.buttons;
+    static uint8_t old_buttons = 0;
+    local_mouse_report.buttons = old_buttons;
+    if (pointing_device_motion_detected()) {
+        local_mouse_report = pointing_device_driver.get_report(local_mouse_report);
+    }
+    old_buttons = local_mouse_report.buttons;
 #    elif defined(POINTING_DEVICE_LEFT) || defined(POINTING_DEVICE_RIGHT)
-        local_mouse_report = POINTING_DEVICE_THIS_SIDE ? pointing_device_driver.get_report(local_mouse_report) : shared_mouse_report;
+    if (!(POINTING_DEVICE_THIS_SIDE)) {
+        local_mouse_report = shared_mouse_report;
+    } else if (pointing_device_motion_detected()) {
+        local_mouse_report = pointing_device_driver.get_report(local_mouse_report);
+    }
 #    else
 #        error "You need to define the side(s) the pointing device is on. POINTING_DEVICE_COMBINED / POINTING_DEVICE_LEFT / POINTING_DEVICE_RIGHT"
 #    endif
 #else
-    local_mouse_report = pointing_device_driver.get_report(local_mouse_report);
-#endif // defined(SPLIT_POINTING_ENABLE)
-
-#ifdef POINTING_DEVICE_MOTION_PIN
+    if (pointing_device_motion_detected()) {
+        local_mouse_report = pointing_device_driver.get_report(local_mouse_report);
     }
-#endif
+#endif // defined(SPLIT_POINTING_ENABLE)
 
     // allow kb to intercept and modify report
 #if defined(SPLIT_POINTING_ENABLE) && defined(POINTING_DEVICE_COMBINED)
@@ -118,8 +118,22 @@ uint8_t        pointing_device_handle_buttons(uint8_t buttons, bool pressed, poi
 report_mouse_t pointing_device_adjust_by_defines(report_mouse_t mouse_report);
 void           pointing_device_keycode_handler(uint16_t keycode, bool pressed);
 
+bool           pointing_device_motion_detected(void);
+
 #if defined(SPLIT_POINTING_ENABLE)
+// Running totals of the motion seen on the slave side. They wrap around and the master works with
+// the difference to its previous read, so a missed or repeated transfer loses no motion.
+typedef struct {
+    uint16_t x;
+    uint16_t y;
+    uint16_t h;
+    uint16_t v;
+    uint8_t  buttons;
+} pointing_device_motion_t;
+
 void     pointing_device_set_shared_report(report_mouse_t report);
+void     pointing_device_add_shared_motion(int16_t x, int16_t y, int16_t h, int16_t v, uint8_t buttons);
+void     pointing_device_accumulate_motion(pointing_device_motion_t *motion);
 uint16_t pointing_device_get_shared_cpi(void);
 #    if !defined(POINTING_DEVICE_TASK_THROTTLE_MS)
 #        define POINTING_DEVICE_TASK_THROTTLE_MS 1
@@ -19,6 +19,16 @@
 #    include "autocorrect_data_default.h"
 #endif
 
+// Dictionaries over 64KB are generated with 3 byte node links.
+#ifndef AUTOCORRECT_LINK_SIZE
+#    define AUTOCORRECT_LINK_SIZE 2
+#endif
+#if AUTOCORRECT_LINK_SIZE > 2
+typedef uint32_t autocorrect_state_t;
+#else
+typedef uint16_t autocorrect_state_t;
+#endif
+
 static uint8_t typo_buffer[AUTOCORRECT_MAX_LENGTH] = {KC_SPC};
 static uint8_t typo_buffer_size                    = 1;
 
@@ -279,18 +289,22 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
     }
 
     // Check for typo in buffer using a trie stored in `autocorrect_data`.
-    uint16_t state = 0;
-    uint8_t  code  = pgm_read_byte(autocorrect_data + state);
+    autocorrect_state_t state = 0;
+    uint8_t             code  = pgm_read_byte(autocorrect_data + state);
     for (int8_t i = typo_buffer_size - 1; i >= 0; --i) {
         uint8_t const key_i = typo_buffer[i];
 
         if (code & 64) { // Check for match in node with multiple children.
             code &= 63;
-            for (; code != key_i; code = pgm_read_byte(autocorrect_data + (state += 3))) {
+            for (; code != key_i; code = pgm_read_byte(autocorrect_data + (state += 1 + AUTOCORRECT_LINK_SIZE))) {
                 if (!code) return true;
             }
             // Follow link to child node.
+#if AUTOCORRECT_LINK_SIZE > 2
+            state = (pgm_read_byte(autocorrect_data + state + 1) | pgm_read_byte(autocorrect_data + state + 2) << 8 | (uint32_t)pgm_read_byte(autocorrect_data + state + 3) << 16);
+#else
             state = (pgm_read_byte(autocorrect_data + state + 1) | pgm_read_byte(autocorrect_data + state + 2) << 8);
+#endif
             // Check for match in node with single child.
         } else if (code != key_i) {
             return true;
@@ -18,10 +18,19 @@
 /* Author: Wojciech Siewierski < wojciech dot siewierski at onet dot pl > */
 #include "process_dynamic_macro.h"
 #include <stddef.h>
+#include <string.h>
 #include "action_layer.h"
 #include "keycodes.h"
+#include "matrix.h"
 #include "debug.h"
 #include "wait.h"
+#include "timer.h"
+
+#ifdef DYNAMIC_MACRO_TIMED_PLAYBACK
+#    ifndef DYNAMIC_MACRO_PLAYBACK_SPEED
+#        define DYNAMIC_MACRO_PLAYBACK_SPEED 100
+#    endif
+#endif
 
 #ifdef BACKLIGHT_ENABLE
 #    include "backlight.h"
@@ -81,9 +90,99 @@ void dynamic_macro_record_start(keyrecord_t **macro_pointer, keyrecord_t *macro_
     *macro_pointer = macro_buffer;
 }
 
+#ifdef DYNAMIC_MACRO_TIMED_PLAYBACK
+/* State of the macro being played back by dynamic_macro_task(). The
+ * recorded event times are replayed as delays between the events, so
+ * the rest of the keyboard keeps running during playback. */
+static keyrecord_t  *playback_pointer = NULL;
+static keyrecord_t  *playback_end;
+static int8_t        playback_direction;
+static uint16_t      playback_timer;
+static uint16_t      playback_delay;
+static bool          playback_replaying = false;
+static layer_state_t playback_layer_state;
+static matrix_row_t  playback_held[MATRIX_ROWS];
+
+/**
+ * Whether a dynamic macro is currently being played back.
+ */
+bool dynamic_macro_is_playing(void) {
+    return playback_pointer != NULL;
+}
+
+/**
+ * Process a record of the macro. The macro keeps its own layer state,
+ * as it was recorded from the base layer, so it neither sees nor
+ * changes the layers the user holds while it plays.
+ */
+static void dynamic_macro_play_record(keyrecord_t *record) {
+    layer_state_t user_layer_state = layer_state;
+    if (playback_layer_state != user_layer_state) {
+        layer_state_set(playback_layer_state);
+    }
+
+    playback_replaying = true;
+    process_record(record);
+    playback_replaying = false;
+
+    playback_layer_state = layer_state;
+    if (playback_layer_state != user_layer_state) {
+        layer_state_set(user_layer_state);
+    }
+
+    /* Remember which keys the macro holds, so only those are released
+     * when the playback is interrupted. */
+    keypos_t key = record->event.key;
+    if (IS_KEYEVENT(record->event) && key.row < MATRIX_ROWS && key.col < MATRIX_COLS) {
+        if (record->event.pressed) {
+            playback_held[key.row] |= (matrix_row_t)1 << key.col;
+        } else {
+            playback_held[key.row] &= ~((matrix_row_t)1 << key.col);
+        }
+    }
+}
+
+/**
+ * Finish the playback, releasing the keys the macro left held.
+ */
+void dynamic_macro_play_stop(void) {
+    if (!dynamic_macro_is_playing()) {
+        return;
+    }
+
+    int8_t direction = playback_direction;
+    playback_pointer = NULL;
+
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (playback_held[row] & ((matrix_row_t)1 << col)) {
+                keyrecord_t record = {.event = MAKE_KEYEVENT(row, col, false)};
+                record.event.time |= 1;
+                dynamic_macro_play_record(&record);
+            }
+        }
+    }
+
+    dynamic_macro_play_user(direction);
+}
+
+/**
+ * Delay before the record after `record`, scaled by the playback speed.
+ */
+static uint16_t dynamic_macro_play_delay(keyrecord_t *record) {
+    uint32_t delay = (uint16_t)((record + playback_direction)->event.time - record->event.time);
+
+    delay = delay * 100 / DYNAMIC_MACRO_PLAYBACK_SPEED;
+    return delay > UINT16_MAX ? UINT16_MAX : delay;
+}
+#endif
+
 /**
  * Play the dynamic macro.
  *
+ * With DYNAMIC_MACRO_TIMED_PLAYBACK this only schedules the playback,
+ * which is then done by dynamic_macro_task().
+ *
  * @param macro_buffer[in] The beginning of the macro buffer being played.
  * @param macro_end[in]    The element after the last macro buffer element.
  * @param direction[in]    Either +1 or -1, which way to iterate the buffer.
@@ -91,6 +190,19 @@ void dynamic_macro_record_start(keyrecord_t **macro_pointer, keyrecord_t *macro_
 void dynamic_macro_play(keyrecord_t *macro_buffer, keyrecord_t *macro_end, int8_t direction) {
     dprintf("dynamic macro: slot %d playback\n", DYNAMIC_MACRO_CURRENT_SLOT());
 
+#ifdef DYNAMIC_MACRO_TIMED_PLAYBACK
+    dynamic_macro_play_stop();
+
+    /* Keys and layers the user holds stay as they are. */
+    playback_layer_state = 0;
+    memset(playback_held, 0, sizeof(playback_held));
+
+    playback_pointer   = macro_buffer;
+    playback_end       = macro_end;
+    playback_direction = direction;
+    playback_timer     = timer_read();
+    playback_delay     = 0;
+#else
     layer_state_t saved_layer_state = layer_state;
 
     clear_keyboard();
@@ -99,9 +211,9 @@ void dynamic_macro_play(keyrecord_t *macro_buffer, keyrecord_t *macro_end, int8_
     while (macro_buffer != macro_end) {
         process_record(macro_buffer);
         macro_buffer += direction;
-#ifdef DYNAMIC_MACRO_DELAY
+#    ifdef DYNAMIC_MACRO_DELAY
         wait_ms(DYNAMIC_MACRO_DELAY);
-#endif
+#    endif
     }
 
     clear_keyboard();
@@ -109,6 +221,34 @@ void dynamic_macro_play(keyrecord_t *macro_buffer, keyrecord_t *macro_end, int8_
     layer_state_set(saved_layer_state);
 
     dynamic_macro_play_user(direction);
+#endif
+}
+
+/**
+ * Play back the records that are due. Does nothing unless
+ * DYNAMIC_MACRO_TIMED_PLAYBACK is defined.
+ */
+void dynamic_macro_task(void) {
+#ifdef DYNAMIC_MACRO_TIMED_PLAYBACK
+    while (dynamic_macro_is_playing() && timer_elapsed(playback_timer) >= playback_delay) {
+        if (playback_pointer == playback_end) {
+            dynamic_macro_play_stop();
+            return;
+        }
+
+        /* Replay a copy so the recording keeps its original times. */
+        keyrecord_t record = *playback_pointer;
+        record.event.time  = timer_read() | 1;
+
+        /* Schedule against the previous deadline rather than now, so
+         * the processing time doesn't add up over long macros. */
+        playback_timer += playback_delay;
+        playback_delay = playback_pointer + playback_direction != playback_end ? dynamic_macro_play_delay(playback_pointer) : 0;
+        playback_pointer += playback_direction;
+
+        dynamic_macro_play_record(&record);
+    }
+#endif
 }
 
 /**
@@ -231,6 +371,18 @@ void dynamic_macro_stop_recording(void) {
  *   }
  */
 bool process_dynamic_macro(uint16_t keycode, keyrecord_t *record) {
+#ifdef DYNAMIC_MACRO_TIMED_PLAYBACK
+    if (dynamic_macro_is_playing() && keycode >= QK_DYNAMIC_MACRO_RECORD_START_1 && keycode <= QK_DYNAMIC_MACRO_PLAY_2) {
+        /* Nested macros can't be scheduled, and any other dynamic macro
+         * key pressed during playback interrupts it. */
+        if (!playback_replaying && !record->event.pressed) {
+            dprintln("dynamic macro: playback interrupted");
+            dynamic_macro_play_stop();
+        }
+        return false;
+    }
+#endif
+
     if (macro_id == 0) {
         /* No macro recording in progress. */
         if (!record->event.pressed) {
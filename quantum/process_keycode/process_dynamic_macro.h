@@ -42,3 +42,8 @@ void dynamic_macro_play_user(int8_t direction);
 void dynamic_macro_record_key_user(int8_t direction, keyrecord_t *record);
 void dynamic_macro_record_end_user(int8_t direction);
 void dynamic_macro_stop_recording(void);
+void dynamic_macro_task(void);
+#ifdef DYNAMIC_MACRO_TIMED_PLAYBACK
+bool dynamic_macro_is_playing(void);
+void dynamic_macro_play_stop(void);
+#endif
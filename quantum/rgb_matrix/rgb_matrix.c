@@ -87,6 +87,13 @@ static last_hit_t last_hit_buffer;
 #if defined(RGB_MATRIX_SPLIT)
 const uint8_t k_rgb_matrix_split[2] = RGB_MATRIX_SPLIT;
 #endif
+#ifdef RGB_MATRIX_SPLIT_LOCKSTEP
+static uint16_t          split_seed;
+static rgb_matrix_hits_t split_hits;
+#    ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
+static uint32_t last_hit_time[LED_HITS_TO_REMEMBER];
+#    endif // RGB_MATRIX_KEYREACTIVE_ENABLED
+#endif     // RGB_MATRIX_SPLIT_LOCKSTEP
 
 EECONFIG_DEBOUNCE_HELPER(rgb_matrix, EECONFIG_RGB_MATRIX, rgb_matrix_config);
 
@@ -156,11 +163,7 @@ void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 #endif
 }
 
-void rgb_matrix_handle_key_event(uint8_t row, uint8_t col, bool pressed) {
-#ifndef RGB_MATRIX_SPLIT
-    if (!is_keyboard_master()) return;
-#endif
-
+static void rgb_matrix_record_hit(uint8_t row, uint8_t col, bool pressed, uint32_t time) {
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
     uint8_t led[LED_HITS_TO_REMEMBER];
     uint8_t led_count = 0;
@@ -179,6 +182,9 @@ void rgb_matrix_handle_key_event(uint8_t row, uint8_t col, bool pressed) {
         memcpy(&last_hit_buffer.y[0], &last_hit_buffer.y[led_count], LED_HITS_TO_REMEMBER - led_count);
         memcpy(&last_hit_buffer.tick[0], &last_hit_buffer.tick[led_count], (LED_HITS_TO_REMEMBER - led_count) * 2); // 16 bit
         memcpy(&last_hit_buffer.index[0], &last_hit_buffer.index[led_count], LED_HITS_TO_REMEMBER - led_count);
+#    ifdef RGB_MATRIX_SPLIT_LOCKSTEP
+        memcpy(&last_hit_time[0], &last_hit_time[led_count], (LED_HITS_TO_REMEMBER - led_count) * sizeof(uint32_t));
+#    endif // RGB_MATRIX_SPLIT_LOCKSTEP
         last_hit_buffer.count = LED_HITS_TO_REMEMBER - led_count;
     }
 
@@ -188,6 +194,9 @@ void rgb_matrix_handle_key_event(uint8_t row, uint8_t col, bool pressed) {
         last_hit_buffer.y[index]     = g_led_config.point[led[i]].y;
         last_hit_buffer.index[index] = led[i];
         last_hit_buffer.tick[index]  = 0;
+#    ifdef RGB_MATRIX_SPLIT_LOCKSTEP
+        last_hit_time[index] = time;
+#    endif // RGB_MATRIX_SPLIT_LOCKSTEP
         last_hit_buffer.count++;
     }
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
@@ -206,6 +215,58 @@ void rgb_matrix_handle_key_event(uint8_t row, uint8_t col, bool pressed) {
 #endif // defined(RGB_MATRIX_FRAMEBUFFER_EFFECTS) && defined(ENABLE_RGB_MATRIX_TYPING_HEATMAP)
 }
 
+void rgb_matrix_handle_key_event(uint8_t row, uint8_t col, bool pressed) {
+#if !defined(RGB_MATRIX_SPLIT) || defined(RGB_MATRIX_SPLIT_LOCKSTEP)
+    // In lockstep the slave replays the hits stamped by the master, its own keys included
+    if (!is_keyboard_master()) return;
+#endif
+
+    uint32_t time = sync_timer_read32();
+#ifdef RGB_MATRIX_SPLIT_LOCKSTEP
+    memmove(&split_hits.hits[0], &split_hits.hits[1], sizeof(rgb_matrix_hit_t) * (RGB_MATRIX_SPLIT_HITS - 1));
+    split_hits.hits[RGB_MATRIX_SPLIT_HITS - 1] = (rgb_matrix_hit_t){.row = row, .col = col, .pressed = pressed, .time = (uint16_t)time};
+    split_hits.count++;
+#endif // RGB_MATRIX_SPLIT_LOCKSTEP
+    rgb_matrix_record_hit(row, col, pressed, time);
+}
+
+#ifdef RGB_MATRIX_SPLIT_LOCKSTEP
+uint16_t rgb_matrix_get_split_seed(void) {
+    return split_seed;
+}
+
+void rgb_matrix_set_split_seed(uint16_t seed) {
+    split_seed = seed;
+}
+
+void rgb_matrix_get_split_hits(rgb_matrix_hits_t *hits) {
+    *hits = split_hits;
+}
+
+void rgb_matrix_set_split_hits(const rgb_matrix_hits_t *hits) {
+    // The first hits of a session can be of any age, they only set where the count starts
+    if (hits->session != split_hits.session) {
+        split_hits.session = hits->session;
+        split_hits.count   = hits->count;
+        return;
+    }
+
+    uint8_t fresh = hits->count - split_hits.count;
+    if (fresh > RGB_MATRIX_SPLIT_HITS) {
+        fresh = RGB_MATRIX_SPLIT_HITS;
+    }
+    split_hits.count = hits->count;
+
+    // Hits carry the low bits of the shared timer, they are at most a few transfers old. A slave
+    // whose timer runs a little behind sees them slightly ahead, they show from the frame reaching them.
+    uint32_t now = sync_timer_read32();
+    for (uint8_t i = RGB_MATRIX_SPLIT_HITS - fresh; i < RGB_MATRIX_SPLIT_HITS; i++) {
+        const rgb_matrix_hit_t *hit = &hits->hits[i];
+        rgb_matrix_record_hit(hit->row, hit->col, hit->pressed, now - (int16_t)(uint16_t)((uint16_t)now - hit->time));
+    }
+}
+#endif // RGB_MATRIX_SPLIT_LOCKSTEP
+
 void rgb_matrix_test(void) {
     // Mask out bits 4 and 5
     // Increase the factor to make the test animation slower (and reduce to make it faster)
@@ -240,13 +301,19 @@ static bool rgb_matrix_none(effect_params_t *params) {
 }
 
 static void rgb_task_timers(void) {
-#if defined(RGB_MATRIX_KEYREACTIVE_ENABLED)
+#ifdef RGB_MATRIX_SPLIT_LOCKSTEP
+    // Frames start on flush limit boundaries of the shared timer, so both halves render the same
+    // instants. Hit ticks are worked out from the frame time in rgb_task_start().
+    rgb_timer_buffer = sync_timer_read32();
+    rgb_timer_buffer -= rgb_timer_buffer % RGB_MATRIX_LED_FLUSH_LIMIT;
+#else
+#    if defined(RGB_MATRIX_KEYREACTIVE_ENABLED)
     uint32_t deltaTime = sync_timer_elapsed32(rgb_timer_buffer);
-#endif // defined(RGB_MATRIX_KEYREACTIVE_ENABLED)
+#    endif // defined(RGB_MATRIX_KEYREACTIVE_ENABLED)
     rgb_timer_buffer = sync_timer_read32();
 
     // Update double buffer last hit timers
-#ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
+#    ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
     uint8_t count = last_hit_buffer.count;
     for (uint8_t i = 0; i < count; ++i) {
         if (UINT16_MAX - deltaTime < last_hit_buffer.tick[i]) {
@@ -255,13 +322,18 @@ static void rgb_task_timers(void) {
         }
         last_hit_buffer.tick[i] += deltaTime;
     }
-#endif // RGB_MATRIX_KEYREACTIVE_ENABLED
+#    endif // RGB_MATRIX_KEYREACTIVE_ENABLED
+#endif     // RGB_MATRIX_SPLIT_LOCKSTEP
 }
 
 static void rgb_task_sync(void) {
     eeconfig_flush_rgb_matrix(false);
     // next task
+#ifdef RGB_MATRIX_SPLIT_LOCKSTEP
+    if (rgb_timer_buffer != g_rgb_timer) rgb_task_state = STARTING;
+#else
     if (sync_timer_elapsed32(g_rgb_timer) >= RGB_MATRIX_LED_FLUSH_LIMIT) rgb_task_state = STARTING;
+#endif // RGB_MATRIX_SPLIT_LOCKSTEP
 }
 
 static void rgb_task_start(void) {
@@ -270,7 +342,21 @@ static void rgb_task_start(void) {
 
     // update double buffers
     g_rgb_timer = rgb_timer_buffer;
-#ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
+#if defined(RGB_MATRIX_KEYREACTIVE_ENABLED) && defined(RGB_MATRIX_SPLIT_LOCKSTEP)
+    // Only hits stamped up to the frame time are shown, whenever they reached this half
+    g_last_hit_tracker.count = 0;
+    for (uint8_t i = 0; i < last_hit_buffer.count; i++) {
+        uint32_t age = g_rgb_timer - last_hit_time[i];
+        if (age > UINT16_MAX) {
+            continue;
+        }
+        uint8_t index                   = g_last_hit_tracker.count++;
+        g_last_hit_tracker.x[index]     = last_hit_buffer.x[i];
+        g_last_hit_tracker.y[index]     = last_hit_buffer.y[i];
+        g_last_hit_tracker.index[index] = last_hit_buffer.index[i];
+        g_last_hit_tracker.tick[index]  = age;
+    }
+#elif defined(RGB_MATRIX_KEYREACTIVE_ENABLED)
     g_last_hit_tracker = last_hit_buffer;
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
@@ -281,6 +367,13 @@ static void rgb_task_start(void) {
 static void rgb_task_render(uint8_t effect) {
     bool rendering         = false;
     rgb_effect_params.init = (effect != rgb_last_effect) || (rgb_matrix_config.enable != rgb_last_enable);
+#ifdef RGB_MATRIX_SPLIT_LOCKSTEP
+    // Random effects draw the same numbers on both halves for a given frame and iteration
+    uint32_t seed = (g_rgb_timer / RGB_MATRIX_LED_FLUSH_LIMIT) * 2654435761UL ^ ((uint32_t)split_seed << 8 | rgb_effect_params.iter);
+    seed ^= seed >> 16;
+    random16_set_seed((uint16_t)seed);
+    srand(seed);
+#endif // RGB_MATRIX_SPLIT_LOCKSTEP
     if (rgb_effect_params.flags != rgb_matrix_config.flags) {
         rgb_effect_params.flags = rgb_matrix_config.flags;
         rgb_matrix_set_color_all(0, 0, 0);
@@ -383,6 +476,14 @@ void rgb_matrix_task(void) {
             rgb_task_sync();
             break;
     }
+
+#if defined(RGB_MATRIX_WS2812) && defined(RGBLIGHT_WS2812)
+    // RGBLight shares the WS2812 chain. Its changes go out with the next
+    // rendered frame, or straight away if there is nothing to render.
+    if (effect == RGB_MATRIX_NONE) {
+        rgb_matrix_driver.flush();
+    }
+#endif
 }
 
 void rgb_matrix_indicators(void) {
@@ -460,6 +561,11 @@ void rgb_matrix_init(void) {
     }
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
+#ifdef RGB_MATRIX_SPLIT_LOCKSTEP
+    // Replaced by the master's seed once the first sync reaches the slave
+    split_seed = (uint16_t)timer_read32() ^ random16_get_seed();
+#endif // RGB_MATRIX_SPLIT_LOCKSTEP
+
     eeconfig_init_rgb_matrix();
     if (!rgb_matrix_config.mode) {
         dprintf("rgb_matrix_init_drivers rgb_matrix_config.mode = 0. Write default values to EEPROM.\n");
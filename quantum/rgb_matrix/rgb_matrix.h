@@ -24,6 +24,7 @@
 #include "rgb_matrix_drivers.h"
 #include "color.h"
 #include "keyboard.h"
+#include "progmem.h"
 
 #ifndef RGB_MATRIX_TIMEOUT
 #    define RGB_MATRIX_TIMEOUT 0
@@ -86,6 +87,14 @@
 #    define RGB_MATRIX_LED_FLUSH_LIMIT 16
 #endif
 
+#if defined(RGB_MATRIX_SPLIT_LOCKSTEP) && !defined(RGB_MATRIX_SPLIT)
+#    error "RGB_MATRIX_SPLIT_LOCKSTEP requires RGB_MATRIX_SPLIT"
+#endif
+
+#if defined(RGB_MATRIX_SPLIT_LOCKSTEP) && defined(DISABLE_SYNC_TIMER)
+#    error "RGB_MATRIX_SPLIT_LOCKSTEP requires the sync timer, it can not be combined with DISABLE_SYNC_TIMER"
+#endif
+
 #ifndef RGB_MATRIX_LED_PROCESS_LIMIT
 #    define RGB_MATRIX_LED_PROCESS_LIMIT ((RGB_MATRIX_LED_COUNT + 4) / 5)
 #endif
@@ -150,6 +159,14 @@ void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue);
 
 void rgb_matrix_handle_key_event(uint8_t row, uint8_t col, bool pressed);
 
+#ifdef RGB_MATRIX_SPLIT_LOCKSTEP
+// Shared render state, the master hands it out and the slave follows it
+uint16_t rgb_matrix_get_split_seed(void);
+void     rgb_matrix_set_split_seed(uint16_t seed);
+void     rgb_matrix_get_split_hits(rgb_matrix_hits_t *hits);
+void     rgb_matrix_set_split_hits(const rgb_matrix_hits_t *hits);
+#endif // RGB_MATRIX_SPLIT_LOCKSTEP
+
 void rgb_matrix_task(void);
 
 // This runs after another backlight effect and replaces
@@ -277,3 +294,13 @@ extern last_hit_t g_last_hit_tracker;
 #ifdef RGB_MATRIX_FRAMEBUFFER_EFFECTS
 extern uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS];
 #endif
+#ifdef RGB_MATRIX_NEIGHBOUR_RADIUS
+// Keyed LEDs within RGB_MATRIX_NEIGHBOUR_RADIUS of LED i, nearest first, are
+// g_led_neighbours[g_led_neighbour_offsets[i]] up to g_led_neighbours[g_led_neighbour_offsets[i + 1]]
+extern const uint16_t        g_led_neighbour_offsets[RGB_MATRIX_LED_COUNT + 1] PROGMEM;
+extern const led_neighbour_t g_led_neighbours[] PROGMEM;
+#endif
+#ifdef RGB_MATRIX_POLAR_TABLE
+// atan2_8() and sqrt16() distance of each LED around k_rgb_matrix_center, generated from info.json
+extern const led_polar_t g_led_polar[RGB_MATRIX_LED_COUNT] PROGMEM;
+#endif
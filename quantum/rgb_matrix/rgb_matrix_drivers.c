@@ -17,6 +17,7 @@
 #include "rgb_matrix_drivers.h"
 
 #include <stdbool.h>
+#include <string.h>
 #include "keyboard.h"
 #include "color.h"
 #include "util.h"
@@ -141,12 +142,7 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
 };
 
 #elif defined(RGB_MATRIX_WS2812)
-#    if defined(RGBLIGHT_WS2812)
-#        pragma message "Cannot use RGBLIGHT and RGB Matrix using WS2812 at the same time."
-#        pragma message "You need to use a custom driver, or re-implement the WS2812 driver to use a different configuration."
-#    endif
-
-// LED color buffer
+// LED color buffer, shared with RGBLight when both use WS2812
 rgb_led_t rgb_matrix_ws2812_array[WS2812_LED_COUNT];
 bool      ws2812_dirty = false;
 
@@ -191,11 +187,32 @@ static inline void setled(int i, uint8_t r, uint8_t g, uint8_t b) {
 }
 
 static void setled_all(uint8_t r, uint8_t g, uint8_t b) {
-    for (int i = 0; i < ARRAY_SIZE(rgb_matrix_ws2812_array); i++) {
+    for (int i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
         setled(i, r, g, b);
     }
 }
 
+#    if defined(RGBLIGHT_WS2812)
+void rgb_matrix_ws2812_setleds_rgblight(rgb_led_t *ledarray, uint16_t number_of_leds) {
+    // RGBLight LEDs follow this half's RGB Matrix LEDs on the chain
+#        if defined(RGB_MATRIX_SPLIT)
+    const uint8_t k_rgb_matrix_split[2] = RGB_MATRIX_SPLIT;
+    uint16_t      offset                = k_rgb_matrix_split[is_keyboard_left() ? 0 : 1];
+#        else
+    uint16_t offset = RGB_MATRIX_LED_COUNT;
+#        endif
+
+    if (offset + number_of_leds > WS2812_LED_COUNT) {
+        number_of_leds = WS2812_LED_COUNT - offset;
+    }
+
+    if (memcmp(&rgb_matrix_ws2812_array[offset], ledarray, number_of_leds * sizeof(rgb_led_t)) != 0) {
+        memcpy(&rgb_matrix_ws2812_array[offset], ledarray, number_of_leds * sizeof(rgb_led_t));
+        ws2812_dirty = true;
+    }
+}
+#    endif
+
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = init,
     .flush         = flush,
@@ -49,3 +49,8 @@ typedef struct {
 } rgb_matrix_driver_t;
 
 extern const rgb_matrix_driver_t rgb_matrix_driver;
+
+#if defined(RGB_MATRIX_WS2812) && defined(RGBLIGHT_WS2812)
+/* Copy RGBLight LEDs into the shared WS2812 chain buffer, they are sent with the next flush. */
+void rgb_matrix_ws2812_setleds_rgblight(rgb_led_t *ledarray, uint16_t number_of_leds);
+#endif
@@ -16,6 +16,10 @@
 
 #pragma once
 
+#ifdef __cplusplus
+#    define _Static_assert static_assert
+#endif
+
 #include <stdint.h>
 #include <stdbool.h>
 #include "color.h"
@@ -40,6 +44,26 @@ typedef struct PACKED {
 } last_hit_t;
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
+#ifdef RGB_MATRIX_SPLIT_LOCKSTEP
+// Key hits the master hands to the slave, oldest first
+#    ifndef RGB_MATRIX_SPLIT_HITS
+#        define RGB_MATRIX_SPLIT_HITS 4
+#    endif // RGB_MATRIX_SPLIT_HITS
+
+typedef struct PACKED {
+    uint8_t  row;
+    uint8_t  col;
+    bool     pressed;
+    uint16_t time; // low 16 bits of the sync timer
+} rgb_matrix_hit_t;
+
+typedef struct PACKED {
+    uint8_t          session; // picked by the master, the slave only replays hits of a session it already follows
+    uint8_t          count;   // running count of hits, tells the slave how many are new
+    rgb_matrix_hit_t hits[RGB_MATRIX_SPLIT_HITS];
+} rgb_matrix_hits_t;
+#endif // RGB_MATRIX_SPLIT_LOCKSTEP
+
 typedef enum rgb_task_states { STARTING, RENDERING, FLUSHING, SYNCING } rgb_task_states;
 
 typedef uint8_t led_flags_t;
@@ -73,6 +97,17 @@ typedef struct PACKED {
     uint8_t     flags[RGB_MATRIX_LED_COUNT];
 } led_config_t;
 
+typedef struct PACKED {
+    uint8_t row;
+    uint8_t col;
+    uint8_t distance;
+} led_neighbour_t;
+
+typedef struct PACKED {
+    uint8_t angle;
+    uint8_t dist;
+} led_polar_t;
+
 typedef union {
     uint64_t raw;
     struct PACKED {
@@ -1041,77 +1041,95 @@ static void rgblight_effect_dummy(animation_status_t *anim) {
     **/
 }
 
-void rgblight_timer_task(void) {
-    if (rgblight_status.timer_enabled) {
-        effect_func_t effect_func   = rgblight_effect_dummy;
-        uint16_t      interval_time = 2000; // dummy interval
-        uint8_t       delta         = rgblight_config.mode - rgblight_status.base_mode;
-        animation_status.delta      = delta;
+#    define RGBLIGHT_EFFECT_STEPPED(mode, func, intervals, shift, velocikey_min, velocikey_max) \
+        { RGBLIGHT_MODE_##mode, ARRAY_SIZE(intervals), shift, velocikey_min, velocikey_max, func, intervals, NULL }
+#    define RGBLIGHT_EFFECT_FIXED(mode, func, interval) \
+        { RGBLIGHT_MODE_##mode, 0, 0, 0, 0, func, NULL, interval }
+
+typedef struct {
+    uint8_t         base_mode;
+    uint8_t         interval_count; // 0 if the effect runs at a fixed interval
+    uint8_t         delta_shift;    // mode delta to interval index
+    uint8_t         velocikey_min;
+    uint8_t         velocikey_max;
+    effect_func_t   func;
+    const uint8_t  *intervals;      // PROGMEM, indexed by mode delta
+    const uint16_t *fixed_interval; // PROGMEM
+} rgblight_effect_t;
 
-        // static light mode, do nothing here
-        if (1 == 0) { // dummy
-        }
+#    ifdef RGBLIGHT_EFFECT_CHRISTMAS
+static const uint16_t RGBLED_CHRISTMAS_INTERVALS[] PROGMEM = {RGBLIGHT_EFFECT_CHRISTMAS_INTERVAL};
+#    endif
+#    ifdef RGBLIGHT_EFFECT_ALTERNATING
+static const uint16_t RGBLED_ALTERNATING_INTERVALS[] PROGMEM = {500};
+#    endif
+
+static const rgblight_effect_t PROGMEM rgblight_effects[] = {
 #    ifdef RGBLIGHT_EFFECT_BREATHING
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_BREATHING) {
-            // breathing mode
-            interval_time = get_interval_time(&RGBLED_BREATHING_INTERVALS[delta], 1, 100);
-            effect_func   = rgblight_effect_breathing;
-        }
+    RGBLIGHT_EFFECT_STEPPED(BREATHING, rgblight_effect_breathing, RGBLED_BREATHING_INTERVALS, 0, 1, 100),
 #    endif
 #    ifdef RGBLIGHT_EFFECT_RAINBOW_MOOD
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_RAINBOW_MOOD) {
-            // rainbow mood mode
-            interval_time = get_interval_time(&RGBLED_RAINBOW_MOOD_INTERVALS[delta], 5, 100);
-            effect_func   = rgblight_effect_rainbow_mood;
-        }
+    RGBLIGHT_EFFECT_STEPPED(RAINBOW_MOOD, rgblight_effect_rainbow_mood, RGBLED_RAINBOW_MOOD_INTERVALS, 0, 5, 100),
 #    endif
 #    ifdef RGBLIGHT_EFFECT_RAINBOW_SWIRL
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_RAINBOW_SWIRL) {
-            // rainbow swirl mode
-            interval_time = get_interval_time(&RGBLED_RAINBOW_SWIRL_INTERVALS[delta / 2], 1, 100);
-            effect_func   = rgblight_effect_rainbow_swirl;
-        }
+    RGBLIGHT_EFFECT_STEPPED(RAINBOW_SWIRL, rgblight_effect_rainbow_swirl, RGBLED_RAINBOW_SWIRL_INTERVALS, 1, 1, 100),
 #    endif
 #    ifdef RGBLIGHT_EFFECT_SNAKE
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_SNAKE) {
-            // snake mode
-            interval_time = get_interval_time(&RGBLED_SNAKE_INTERVALS[delta / 2], 1, 200);
-            effect_func   = rgblight_effect_snake;
-        }
+    RGBLIGHT_EFFECT_STEPPED(SNAKE, rgblight_effect_snake, RGBLED_SNAKE_INTERVALS, 1, 1, 200),
 #    endif
 #    ifdef RGBLIGHT_EFFECT_KNIGHT
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_KNIGHT) {
-            // knight mode
-            interval_time = get_interval_time(&RGBLED_KNIGHT_INTERVALS[delta], 5, 100);
-            effect_func   = rgblight_effect_knight;
-        }
+    RGBLIGHT_EFFECT_STEPPED(KNIGHT, rgblight_effect_knight, RGBLED_KNIGHT_INTERVALS, 0, 5, 100),
 #    endif
 #    ifdef RGBLIGHT_EFFECT_CHRISTMAS
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_CHRISTMAS) {
-            // christmas mode
-            interval_time = RGBLIGHT_EFFECT_CHRISTMAS_INTERVAL;
-            effect_func   = (effect_func_t)rgblight_effect_christmas;
-        }
+    RGBLIGHT_EFFECT_FIXED(CHRISTMAS, rgblight_effect_christmas, RGBLED_CHRISTMAS_INTERVALS),
 #    endif
 #    ifdef RGBLIGHT_EFFECT_RGB_TEST
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_RGB_TEST) {
-            // RGB test mode
-            interval_time = pgm_read_word(&RGBLED_RGBTEST_INTERVALS[0]);
-            effect_func   = (effect_func_t)rgblight_effect_rgbtest;
-        }
+    RGBLIGHT_EFFECT_FIXED(RGB_TEST, rgblight_effect_rgbtest, RGBLED_RGBTEST_INTERVALS),
 #    endif
 #    ifdef RGBLIGHT_EFFECT_ALTERNATING
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_ALTERNATING) {
-            interval_time = 500;
-            effect_func   = (effect_func_t)rgblight_effect_alternating;
-        }
+    RGBLIGHT_EFFECT_FIXED(ALTERNATING, rgblight_effect_alternating, RGBLED_ALTERNATING_INTERVALS),
 #    endif
 #    ifdef RGBLIGHT_EFFECT_TWINKLE
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_TWINKLE) {
-            interval_time = get_interval_time(&RGBLED_TWINKLE_INTERVALS[delta % 3], 5, 30);
-            effect_func   = (effect_func_t)rgblight_effect_twinkle;
-        }
+    RGBLIGHT_EFFECT_STEPPED(TWINKLE, rgblight_effect_twinkle, RGBLED_TWINKLE_INTERVALS, 0, 5, 30),
 #    endif
+    // dummy entry, matches static modes
+    RGBLIGHT_EFFECT_FIXED(zero, rgblight_effect_dummy, NULL),
+};
+
+// Looks up the effect descriptor for a base mode, only done when the mode changes
+static void rgblight_effect_load(uint8_t base_mode, rgblight_effect_t *effect) {
+    uint8_t i = 0;
+    while (i < ARRAY_SIZE(rgblight_effects) - 1 && pgm_read_byte(&rgblight_effects[i].base_mode) != base_mode) {
+        ++i;
+    }
+    memcpy_P(effect, &rgblight_effects[i], sizeof(rgblight_effect_t));
+    effect->base_mode = base_mode;
+}
+
+static uint16_t rgblight_effect_interval(const rgblight_effect_t *effect, uint8_t delta) {
+#    if defined(RGBLIGHT_EFFECT_BREATHING) || defined(RGBLIGHT_EFFECT_RAINBOW_MOOD) || defined(RGBLIGHT_EFFECT_RAINBOW_SWIRL) || defined(RGBLIGHT_EFFECT_SNAKE) || defined(RGBLIGHT_EFFECT_KNIGHT) || defined(RGBLIGHT_EFFECT_TWINKLE)
+    if (effect->interval_count) {
+        return get_interval_time(&effect->intervals[(delta >> effect->delta_shift) % effect->interval_count], effect->velocikey_min, effect->velocikey_max);
+    }
+#    endif
+    if (effect->fixed_interval) {
+        return pgm_read_word(effect->fixed_interval);
+    }
+    return 2000; // dummy interval
+}
+
+void rgblight_timer_task(void) {
+    if (rgblight_status.timer_enabled) {
+        static rgblight_effect_t effect = {.func = rgblight_effect_dummy};
+        if (effect.base_mode != rgblight_status.base_mode) {
+            rgblight_effect_load(rgblight_status.base_mode, &effect);
+        }
+
+        effect_func_t effect_func   = effect.func;
+        uint8_t       delta         = rgblight_config.mode - rgblight_status.base_mode;
+        uint16_t      interval_time = rgblight_effect_interval(&effect, delta);
+        animation_status.delta      = delta;
+
         if (animation_status.restart) {
             animation_status.restart    = false;
             animation_status.last_timer = sync_timer_read();
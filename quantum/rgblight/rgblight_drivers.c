@@ -3,7 +3,17 @@
 
 #include "rgblight_drivers.h"
 
-#if defined(RGBLIGHT_WS2812)
+#if defined(RGBLIGHT_WS2812) && defined(RGB_MATRIX_WS2812)
+#    include "ws2812.h"
+#    include "rgb_matrix_drivers.h"
+
+// Chained after the RGB Matrix LEDs, flushed by RGB Matrix
+const rgblight_driver_t rgblight_driver = {
+    .init    = ws2812_init,
+    .setleds = rgb_matrix_ws2812_setleds_rgblight,
+};
+
+#elif defined(RGBLIGHT_WS2812)
 #    include "ws2812.h"
 
 const rgblight_driver_t rgblight_driver = {
@@ -214,6 +214,9 @@ void split_pre_init(void) {
 
     if (is_keyboard_master()) {
         transport_master_init();
+#ifdef SPLIT_NOTIFY_PIN
+        gpio_set_pin_input_high(SPLIT_NOTIFY_PIN);
+#endif
     }
 }
 
@@ -223,6 +226,11 @@ void split_pre_init(void) {
 void split_post_init(void) {
     if (!is_keyboard_master()) {
         transport_slave_init();
+#ifdef SPLIT_NOTIFY_PIN
+        // Active low, released until there is something to report
+        gpio_set_pin_output(SPLIT_NOTIFY_PIN);
+        gpio_write_pin_high(SPLIT_NOTIFY_PIN);
+#endif
 #if defined(SPLIT_WATCHDOG_ENABLE)
         split_watchdog_init();
 #endif
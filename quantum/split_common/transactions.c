@@ -71,6 +71,14 @@
 #    define FORCED_SYNC_THROTTLE_MS 100
 #endif // FORCED_SYNC_THROTTLE_MS
 
+#if defined(OLED_ENABLE) && defined(SPLIT_OLED_BUFFER_ENABLE) && !defined(SPLIT_OLED_BUFFER_INTERVAL)
+#    define SPLIT_OLED_BUFFER_INTERVAL 5
+#endif // defined(OLED_ENABLE) && defined(SPLIT_OLED_BUFFER_ENABLE) && !defined(SPLIT_OLED_BUFFER_INTERVAL)
+
+#if defined(SPLIT_NOTIFY_PIN) && !defined(SPLIT_NOTIFY_KEEPALIVE_MS)
+#    define SPLIT_NOTIFY_KEEPALIVE_MS FORCED_SYNC_THROTTLE_MS
+#endif // defined(SPLIT_NOTIFY_PIN) && !defined(SPLIT_NOTIFY_KEEPALIVE_MS)
+
 #define sizeof_member(type, member) sizeof(((type *)NULL)->member)
 
 #define trans_initiator2target_initializer_cb(member, cb) \
@@ -84,9 +92,13 @@
 #define trans_initiator2target_cb(cb) \
     { 0, 0, 0, 0, cb }
 
-#define transport_write(id, data, length) transport_execute_transaction(id, data, length, NULL, 0)
-#define transport_read(id, data, length) transport_execute_transaction(id, NULL, 0, data, length)
-#define transport_exec(id) transport_execute_transaction(id, NULL, 0, NULL, 0)
+#ifndef SPLIT_TRANSACTION_STATS_ENABLE
+#    define transaction_execute(id, i2t_buf, i2t_len, t2i_buf, t2i_len) transport_execute_transaction(id, i2t_buf, i2t_len, t2i_buf, t2i_len)
+#endif // SPLIT_TRANSACTION_STATS_ENABLE
+
+#define transport_write(id, data, length) transaction_execute(id, data, length, NULL, 0)
+#define transport_read(id, data, length) transaction_execute(id, NULL, 0, data, length)
+#define transport_exec(id) transaction_execute(id, NULL, 0, NULL, 0)
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 // Forward-declare the RPC callback handlers
@@ -94,6 +106,153 @@ void slave_rpc_info_callback(uint8_t initiator2target_buffer_size, const void *i
 void slave_rpc_exec_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer);
 #endif // defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 
+////////////////////////////////////////////////////
+// Link statistics and budget
+
+#ifdef SPLIT_TRANSACTION_STATS_ENABLE
+
+#    if defined(PROTOCOL_CHIBIOS)
+#        include <ch.h>
+typedef systime_t split_timestamp_t;
+#        define split_timestamp_read() chVTGetSystemTimeX()
+#        define split_timestamp_elapsed_us(start) ((uint32_t)chTimeI2US(chVTTimeElapsedSinceX(start)))
+#    else
+// Only millisecond resolution, short transfers average out over many loops. That is enough for
+// the statistics, not for SPLIT_SYNC_BUDGET_US, which AVR builds reject. The test platform's clock
+// moves in whole milliseconds of simulated link time.
+typedef uint32_t split_timestamp_t;
+#        define split_timestamp_read() timer_read32()
+#        define split_timestamp_elapsed_us(start) (timer_elapsed32(start) * 1000)
+#    endif
+
+static split_transaction_stats_t transaction_stats[NUM_TOTAL_TRANSACTIONS];
+static uint32_t                  loop_us         = 0; // transport time spent in the current master loop
+static uint32_t                  loop_average_x8 = 0; // moving average of loop_us, scaled by 8
+static uint32_t                  confirmed_us    = 0; // part of the running transaction spent confirming earlier writes
+
+#    ifdef SPLIT_SYNC_BUDGET_US
+static void sync_budget_charge(int8_t id, uint32_t us, bool confirmed);
+#    else
+#        define sync_budget_charge(id, us, confirmed)
+#    endif // SPLIT_SYNC_BUDGET_US
+
+static bool transaction_execute(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+    confirmed_us              = 0;
+    split_timestamp_t start   = split_timestamp_read();
+    bool              okay    = transport_execute_transaction(id, initiator2target_buf, initiator2target_length, target2initiator_buf, target2initiator_length);
+    uint32_t          elapsed = split_timestamp_elapsed_us(start);
+
+    // Confirming earlier pipelined writes took link time in this loop, but it was charged to those writes
+    loop_us += elapsed;
+    elapsed -= confirmed_us < elapsed ? confirmed_us : elapsed;
+
+    split_transaction_stats_t *stats = &transaction_stats[id];
+    if (okay) {
+        stats->count++;
+    } else {
+        stats->errors++;
+    }
+    stats->total_us += elapsed;
+    if (elapsed > stats->max_us) {
+        stats->max_us = elapsed;
+    }
+    sync_budget_charge(id, elapsed, false);
+    return okay;
+}
+
+void split_transaction_confirmed(int8_t id, uint32_t us) {
+    if (id < 0 || id >= NUM_TOTAL_TRANSACTIONS) {
+        return;
+    }
+    transaction_stats[id].total_us += us;
+    confirmed_us += us;
+    sync_budget_charge(id, us, true);
+}
+
+const split_transaction_stats_t *split_transaction_stats(int8_t id) {
+    return (id >= 0 && id < NUM_TOTAL_TRANSACTIONS) ? &transaction_stats[id] : NULL;
+}
+
+uint32_t split_transaction_loop_us(void) {
+    return loop_average_x8 / 8;
+}
+
+void split_transaction_stats_reset(void) {
+    memset(transaction_stats, 0, sizeof(transaction_stats));
+}
+
+#endif // SPLIT_TRANSACTION_STATS_ENABLE
+
+#ifdef SPLIT_SYNC_BUDGET_US
+
+// Low priority sync intervals are scaled by sync_stretch / SPLIT_SYNC_STRETCH_UNIT
+#    define SPLIT_SYNC_STRETCH_UNIT 4
+#    define SPLIT_SYNC_STRETCH_MIN (SPLIT_SYNC_STRETCH_UNIT / 2)
+#    define SPLIT_SYNC_STRETCH_MAX (SPLIT_SYNC_STRETCH_UNIT * 8)
+
+typedef struct _deferrable_sync_t {
+    uint32_t last_run; // last loop the handler was allowed to run in
+    uint32_t cost_us;  // transport time of its last run that used the link
+} deferrable_sync_t;
+
+static uint8_t            sync_stretch = SPLIT_SYNC_STRETCH_UNIT;
+static deferrable_sync_t *sync_running = NULL;  // low priority handler running right now
+static bool               sync_used    = false; // set once the running handler uses the link
+static deferrable_sync_t *sync_owner[NUM_TOTAL_TRANSACTIONS]; // low priority handler that last ran each transaction
+
+static uint32_t stretch_sync_interval(uint32_t interval) {
+    return sync_running ? interval * sync_stretch / SPLIT_SYNC_STRETCH_UNIT : interval;
+}
+
+// Adds transport time to the cost of the low priority handler behind the transaction, a pipelined
+// write is confirmed later on, possibly while another handler runs
+static void sync_budget_charge(int8_t id, uint32_t us, bool confirmed) {
+    if (!confirmed) {
+        sync_owner[id] = sync_running;
+        sync_used      = true;
+    }
+    if (sync_owner[id]) {
+        sync_owner[id]->cost_us += us;
+    }
+}
+
+uint32_t split_sync_throttle(void) {
+    return FORCED_SYNC_THROTTLE_MS * sync_stretch / SPLIT_SYNC_STRETCH_UNIT;
+}
+
+// Folds the previous loop into the average and moves the stretch factor towards the budget
+static void sync_budget_begin_loop(void) {
+    loop_average_x8 += loop_us - loop_average_x8 / 8;
+    loop_us = 0;
+
+    uint32_t average = loop_average_x8 / 8;
+    if (average > SPLIT_SYNC_BUDGET_US) {
+        if (sync_stretch < SPLIT_SYNC_STRETCH_MAX) {
+            sync_stretch++;
+        }
+    } else if (average < SPLIT_SYNC_BUDGET_US / 2) {
+        if (sync_stretch > SPLIT_SYNC_STRETCH_MIN) {
+            sync_stretch--;
+        }
+    }
+}
+
+#elif defined(SPLIT_TRANSACTION_STATS_ENABLE)
+
+#    define stretch_sync_interval(interval) (interval)
+
+static void sync_budget_begin_loop(void) {
+    loop_average_x8 += loop_us - loop_average_x8 / 8;
+    loop_us = 0;
+}
+
+#else // SPLIT_SYNC_BUDGET_US
+
+#    define stretch_sync_interval(interval) (interval)
+#    define sync_budget_begin_loop()
+
+#endif // SPLIT_SYNC_BUDGET_US
+
 ////////////////////////////////////////////////////
 // Helpers
 
@@ -118,6 +277,40 @@ static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_
         if (!transaction_handler_master(master_matrix, slave_matrix, #prefix, &prefix##_handlers_master)) return false; \
     } while (0)
 
+#ifdef SPLIT_SYNC_BUDGET_US
+inline static bool transaction_handler_deferrable(matrix_row_t master_matrix[], matrix_row_t slave_matrix[], const char *prefix, bool (*handler)(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]), deferrable_sync_t *sync) {
+    // Skip the loop if this handler would overrun the budget, unless it has already been waiting for a full (stretched) throttle period
+    if (loop_us + sync->cost_us > SPLIT_SYNC_BUDGET_US && timer_elapsed32(sync->last_run) < split_sync_throttle()) {
+        return true;
+    }
+
+    uint32_t cost  = sync->cost_us;
+    sync->last_run = timer_read32();
+    sync->cost_us  = 0;
+    sync_running   = sync;
+    sync_used      = false;
+    bool okay      = transaction_handler_master(master_matrix, slave_matrix, prefix, handler);
+    sync_running   = NULL;
+    // A run that did not use the link keeps the last known cost
+    if (!sync_used) {
+        sync->cost_us = cost;
+    }
+    return okay;
+}
+
+/**
+ * @brief Constructs a transaction handler for low priority syncs, which are
+ * deferred to later loops while the link is over its time budget.
+ */
+#    define TRANSACTION_HANDLER_MASTER_DEFERRABLE(prefix)                                                                                        \
+        do {                                                                                                                                     \
+            static deferrable_sync_t prefix##_sync = {0};                                                                                        \
+            if (!transaction_handler_deferrable(master_matrix, slave_matrix, #prefix, &prefix##_handlers_master, &prefix##_sync)) return false; \
+        } while (0)
+#else
+#    define TRANSACTION_HANDLER_MASTER_DEFERRABLE(prefix) TRANSACTION_HANDLER_MASTER(prefix)
+#endif // SPLIT_SYNC_BUDGET_US
+
 /**
  * @brief Constructs a transaction handler that doesn't acquire a lock to the
  * split shared memory. Therefore the locking and unlocking has to be done
@@ -144,10 +337,22 @@ static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_
         split_shared_memory_unlock();                         \
     } while (0)
 
+#ifdef SPLIT_NOTIFY_PIN
+// Set for master loops where the slave has not signalled any change, slave data is then not read
+static bool split_notify_idle = false;
+#endif // SPLIT_NOTIFY_PIN
+
 inline static bool read_if_checksum_mismatch(int8_t trans_id_checksum, int8_t trans_id_retrieve, uint32_t *last_update, void *destination, const void *equiv_shmem, size_t length) {
+#ifdef SPLIT_NOTIFY_PIN
+    if (split_notify_idle) {
+        memcpy(destination, equiv_shmem, length);
+        return true;
+    }
+#endif // SPLIT_NOTIFY_PIN
+
     uint8_t curr_checksum;
     bool    okay = transport_read(trans_id_checksum, &curr_checksum, sizeof(curr_checksum));
-    if (okay && (timer_elapsed32(*last_update) >= FORCED_SYNC_THROTTLE_MS || curr_checksum != crc8(equiv_shmem, length))) {
+    if (okay && (timer_elapsed32(*last_update) >= stretch_sync_interval(FORCED_SYNC_THROTTLE_MS) || curr_checksum != crc8(equiv_shmem, length))) {
         okay &= transport_read(trans_id_retrieve, destination, length);
         okay &= curr_checksum == crc8(equiv_shmem, length);
         if (okay) {
@@ -161,7 +366,7 @@ inline static bool read_if_checksum_mismatch(int8_t trans_id_checksum, int8_t tr
 
 inline static bool send_if_condition(int8_t trans_id, uint32_t *last_update, bool condition, void *source, size_t length) {
     bool okay = true;
-    if (timer_elapsed32(*last_update) >= FORCED_SYNC_THROTTLE_MS || condition) {
+    if (timer_elapsed32(*last_update) >= stretch_sync_interval(FORCED_SYNC_THROTTLE_MS) || condition) {
         okay &= transport_write(trans_id, source, length);
         if (okay) {
             *last_update = timer_read32();
@@ -178,12 +383,16 @@ inline static bool send_if_data_mismatch(int8_t trans_id, uint32_t *last_update,
 ////////////////////////////////////////////////////
 // Slave matrix
 
+// Set when the current loop fetched a changed slave matrix, bulk syncs back off for that loop
+static bool slave_matrix_changed = false;
+
 static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t     last_update                    = 0;
     static matrix_row_t last_matrix[(MATRIX_ROWS) / 2] = {0}; // last successfully-read matrix, so we can replicate if there are checksum errors
     matrix_row_t        temp_matrix[(MATRIX_ROWS) / 2];       // holding area while we test whether or not checksum is correct
 
     bool okay = read_if_checksum_mismatch(GET_SLAVE_MATRIX_CHECKSUM, GET_SLAVE_MATRIX_DATA, &last_update, temp_matrix, split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
+    slave_matrix_changed = okay && memcmp(last_matrix, temp_matrix, sizeof(temp_matrix)) != 0;
     if (okay) {
         // Checksum matches the received data, save as the last matrix state
         memcpy(last_matrix, temp_matrix, sizeof(temp_matrix));
@@ -523,7 +732,7 @@ static void rgblight_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
     }
 }
 
-#    define TRANSACTIONS_RGBLIGHT_MASTER() TRANSACTION_HANDLER_MASTER(rgblight)
+#    define TRANSACTIONS_RGBLIGHT_MASTER() TRANSACTION_HANDLER_MASTER_DEFERRABLE(rgblight)
 #    define TRANSACTIONS_RGBLIGHT_SLAVE() TRANSACTION_HANDLER_SLAVE(rgblight)
 #    define TRANSACTIONS_RGBLIGHT_REGISTRATIONS [PUT_RGBLIGHT] = trans_initiator2target_initializer(rgblight_sync),
 
@@ -557,7 +766,7 @@ static void led_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
     led_matrix_set_suspend_state(led_suspend_state);
 }
 
-#    define TRANSACTIONS_LED_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(led_matrix)
+#    define TRANSACTIONS_LED_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER_DEFERRABLE(led_matrix)
 #    define TRANSACTIONS_LED_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE(led_matrix)
 #    define TRANSACTIONS_LED_MATRIX_REGISTRATIONS [PUT_LED_MATRIX] = trans_initiator2target_initializer(led_matrix_sync),
 
@@ -579,21 +788,52 @@ static bool rgb_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_
     rgb_matrix_sync_t rgb_matrix_sync;
     memcpy(&rgb_matrix_sync.rgb_matrix, &rgb_matrix_config, sizeof(rgb_config_t));
     rgb_matrix_sync.rgb_suspend_state = rgb_matrix_get_suspend_state();
-    return send_if_data_mismatch(PUT_RGB_MATRIX, &last_update, &rgb_matrix_sync, &split_shmem->rgb_matrix_sync, sizeof(rgb_matrix_sync));
+#    ifdef RGB_MATRIX_SPLIT_LOCKSTEP
+    rgb_matrix_sync.rgb_seed = rgb_matrix_get_split_seed();
+#    endif // RGB_MATRIX_SPLIT_LOCKSTEP
+    bool okay = send_if_data_mismatch(PUT_RGB_MATRIX, &last_update, &rgb_matrix_sync, &split_shmem->rgb_matrix_sync, sizeof(rgb_matrix_sync));
+
+#    ifdef RGB_MATRIX_SPLIT_LOCKSTEP
+    // Key hits only go out when there are new ones, the slave skips any it already replayed
+    static uint32_t   last_hits_update = 0;
+    static uint8_t    hits_session     = 0;
+    rgb_matrix_hits_t rgb_matrix_hits;
+    rgb_matrix_get_split_hits(&rgb_matrix_hits);
+    // A restarted master or a returning slave starts a new session, so hits it missed are not replayed late
+    if (!hits_session) {
+        hits_session = (uint8_t)rgb_matrix_get_split_seed() | 1;
+    } else if (!is_transport_connected()) {
+        hits_session = hits_session == UINT8_MAX ? 1 : hits_session + 1;
+    }
+    rgb_matrix_hits.session = hits_session;
+    okay &= send_if_condition(PUT_RGB_MATRIX_HITS, &last_hits_update, rgb_matrix_hits.session != split_shmem->rgb_matrix_hits.session || rgb_matrix_hits.count != split_shmem->rgb_matrix_hits.count, &rgb_matrix_hits, sizeof(rgb_matrix_hits));
+#    endif // RGB_MATRIX_SPLIT_LOCKSTEP
+    return okay;
 }
 
 static void rgb_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     split_shared_memory_lock();
     memcpy(&rgb_matrix_config, &split_shmem->rgb_matrix_sync.rgb_matrix, sizeof(rgb_config_t));
     bool rgb_suspend_state = split_shmem->rgb_matrix_sync.rgb_suspend_state;
+#    ifdef RGB_MATRIX_SPLIT_LOCKSTEP
+    rgb_matrix_set_split_seed(split_shmem->rgb_matrix_sync.rgb_seed);
+    rgb_matrix_hits_t rgb_matrix_hits = split_shmem->rgb_matrix_hits;
+#    endif // RGB_MATRIX_SPLIT_LOCKSTEP
     split_shared_memory_unlock();
 
     rgb_matrix_set_suspend_state(rgb_suspend_state);
+#    ifdef RGB_MATRIX_SPLIT_LOCKSTEP
+    rgb_matrix_set_split_hits(&rgb_matrix_hits);
+#    endif // RGB_MATRIX_SPLIT_LOCKSTEP
 }
 
-#    define TRANSACTIONS_RGB_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(rgb_matrix)
+#    define TRANSACTIONS_RGB_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER_DEFERRABLE(rgb_matrix)
 #    define TRANSACTIONS_RGB_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE(rgb_matrix)
-#    define TRANSACTIONS_RGB_MATRIX_REGISTRATIONS [PUT_RGB_MATRIX] = trans_initiator2target_initializer(rgb_matrix_sync),
+#    ifdef RGB_MATRIX_SPLIT_LOCKSTEP
+#        define TRANSACTIONS_RGB_MATRIX_REGISTRATIONS [PUT_RGB_MATRIX] = trans_initiator2target_initializer(rgb_matrix_sync), [PUT_RGB_MATRIX_HITS] = trans_initiator2target_initializer(rgb_matrix_hits),
+#    else
+#        define TRANSACTIONS_RGB_MATRIX_REGISTRATIONS [PUT_RGB_MATRIX] = trans_initiator2target_initializer(rgb_matrix_sync),
+#    endif // RGB_MATRIX_SPLIT_LOCKSTEP
 
 #else // defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
 
@@ -618,7 +858,7 @@ static void wpm_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_
     set_current_wpm(split_shmem->current_wpm);
 }
 
-#    define TRANSACTIONS_WPM_MASTER() TRANSACTION_HANDLER_MASTER(wpm)
+#    define TRANSACTIONS_WPM_MASTER() TRANSACTION_HANDLER_MASTER_DEFERRABLE(wpm)
 #    define TRANSACTIONS_WPM_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(wpm)
 #    define TRANSACTIONS_WPM_REGISTRATIONS [PUT_WPM] = trans_initiator2target_initializer(current_wpm),
 
@@ -653,7 +893,7 @@ static void oled_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave
     }
 }
 
-#    define TRANSACTIONS_OLED_MASTER() TRANSACTION_HANDLER_MASTER(oled)
+#    define TRANSACTIONS_OLED_MASTER() TRANSACTION_HANDLER_MASTER_DEFERRABLE(oled)
 #    define TRANSACTIONS_OLED_SLAVE() TRANSACTION_HANDLER_SLAVE(oled)
 #    define TRANSACTIONS_OLED_REGISTRATIONS [PUT_OLED] = trans_initiator2target_initializer(current_oled_state),
 
@@ -665,6 +905,76 @@ static void oled_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave
 
 #endif // defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE)
 
+////////////////////////////////////////////////////
+// OLED framebuffer
+
+#if defined(OLED_ENABLE) && defined(SPLIT_OLED_BUFFER_ENABLE)
+
+static bool oled_buffer_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static uint32_t last_update = 0;
+    static uint8_t  sequence    = 0;
+    static bool     connected   = false;
+
+    // A slave that comes back may have restarted with a blank display, so it gets a full frame
+    if (is_transport_connected() != connected) {
+        connected = !connected;
+        if (connected) {
+            oled_remote_invalidate();
+        }
+    }
+
+    // Display data is only sent in loops that are not already busy delivering keypresses
+    if (slave_matrix_changed || timer_elapsed32(last_update) < stretch_sync_interval(SPLIT_OLED_BUFFER_INTERVAL)) {
+        return true;
+    }
+
+    split_oled_buffer_sync_t chunk;
+    chunk.length = oled_remote_encode(chunk.data, sizeof(chunk.data));
+    if (chunk.length == 0) {
+        return true;
+    }
+
+    // Zero is what the slave starts out with, so never use it for real data
+    if (++sequence == 0) {
+        sequence = 1;
+    }
+    chunk.sequence = sequence;
+
+    last_update = timer_read32();
+    bool okay   = transport_write(PUT_OLED_BUFFER, &chunk, sizeof(chunk));
+    if (!okay) {
+        // No telling which blocks made it across, start again from a full frame
+        oled_remote_invalidate();
+    }
+    return okay;
+}
+
+static void oled_buffer_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static uint8_t last_sequence = 0;
+
+    split_oled_buffer_sync_t chunk;
+    split_shared_memory_lock();
+    memcpy(&chunk, &split_shmem->oled_buffer, sizeof(chunk));
+    split_shared_memory_unlock();
+
+    if (chunk.sequence != last_sequence && chunk.length <= sizeof(chunk.data)) {
+        last_sequence = chunk.sequence;
+        oled_remote_decode(chunk.data, chunk.length);
+    }
+}
+
+#    define TRANSACTIONS_OLED_BUFFER_MASTER() TRANSACTION_HANDLER_MASTER_DEFERRABLE(oled_buffer)
+#    define TRANSACTIONS_OLED_BUFFER_SLAVE() TRANSACTION_HANDLER_SLAVE(oled_buffer)
+#    define TRANSACTIONS_OLED_BUFFER_REGISTRATIONS [PUT_OLED_BUFFER] = trans_initiator2target_initializer(oled_buffer),
+
+#else // defined(OLED_ENABLE) && defined(SPLIT_OLED_BUFFER_ENABLE)
+
+#    define TRANSACTIONS_OLED_BUFFER_MASTER()
+#    define TRANSACTIONS_OLED_BUFFER_SLAVE()
+#    define TRANSACTIONS_OLED_BUFFER_REGISTRATIONS
+
+#endif // defined(OLED_ENABLE) && defined(SPLIT_OLED_BUFFER_ENABLE)
+
 ////////////////////////////////////////////////////
 // ST7565
 
@@ -688,7 +998,7 @@ static void st7565_handlers_slave(matrix_row_t master_matrix[], matrix_row_t sla
     }
 }
 
-#    define TRANSACTIONS_ST7565_MASTER() TRANSACTION_HANDLER_MASTER(st7565)
+#    define TRANSACTIONS_ST7565_MASTER() TRANSACTION_HANDLER_MASTER_DEFERRABLE(st7565)
 #    define TRANSACTIONS_ST7565_SLAVE() TRANSACTION_HANDLER_SLAVE(st7565)
 #    define TRANSACTIONS_ST7565_REGISTRATIONS [PUT_ST7565] = trans_initiator2target_initializer(current_st7565_state),
 
@@ -715,13 +1025,28 @@ static bool pointing_handlers_master(matrix_row_t master_matrix[], matrix_row_t
         return true;
     }
 #    endif
-    static uint32_t last_update     = 0;
-    static uint32_t last_cpi_update = 0;
-    static uint16_t last_cpi        = 0;
-    report_mouse_t  temp_state;
-    uint16_t        temp_cpi;
-    bool            okay = read_if_checksum_mismatch(GET_POINTING_CHECKSUM, GET_POINTING_DATA, &last_update, &temp_state, &split_shmem->pointing.report, sizeof(temp_state));
-    if (okay) pointing_device_set_shared_report(temp_state);
+    static uint32_t                 last_update     = 0;
+    static uint32_t                 last_cpi_update = 0;
+    static uint16_t                 last_cpi        = 0;
+    static pointing_device_motion_t last_motion     = {0};
+    static bool                     motion_synced   = false;
+    split_slave_pointing_report_t   temp_report;
+    uint16_t                        temp_cpi;
+    bool                            okay = read_if_checksum_mismatch(GET_POINTING_CHECKSUM, GET_POINTING_DATA, &last_update, &temp_report, &split_shmem->pointing.report, sizeof(temp_report));
+    if (okay) {
+        // The totals start over whenever either side does, the read after that is only a reference
+        const pointing_device_motion_t *motion = &temp_report.motion;
+        if (motion_synced && temp_report.session) {
+            pointing_device_add_shared_motion((int16_t)(motion->x - last_motion.x), (int16_t)(motion->y - last_motion.y), (int16_t)(motion->h - last_motion.h), (int16_t)(motion->v - last_motion.v), motion->buttons);
+        }
+        last_motion   = *motion;
+        motion_synced = true;
+        if (!temp_report.session) {
+            // Marks the slave's totals as known, a restarted slave reports 0 again
+            uint8_t session = 1;
+            okay &= transport_write(PUT_POINTING_SESSION, &session, sizeof(session));
+        }
+    }
     temp_cpi = pointing_device_get_shared_cpi();
     if (temp_cpi) {
         split_shmem->pointing.cpi = temp_cpi;
@@ -756,26 +1081,28 @@ static void pointing_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
     uint16_t temp_cpi = !pointing_device_driver.get_cpi ? 0 : pointing_device_driver.get_cpi(); // check for NULL
 
     split_shared_memory_lock();
-    split_slave_pointing_sync_t pointing;
-    memcpy(&pointing, &split_shmem->pointing, sizeof(split_slave_pointing_sync_t));
+    uint16_t                 cpi    = split_shmem->pointing.cpi;
+    pointing_device_motion_t motion = split_shmem->pointing.report.motion;
     split_shared_memory_unlock();
 
-    if (pointing.cpi && pointing.cpi != temp_cpi && pointing_device_driver.set_cpi) {
-        pointing_device_driver.set_cpi(pointing.cpi);
+    if (cpi && cpi != temp_cpi && pointing_device_driver.set_cpi) {
+        pointing_device_driver.set_cpi(cpi);
     }
 
-    pointing.report = pointing_device_driver.get_report((report_mouse_t){0});
-    // Now update the checksum given that the pointing has been written to
-    pointing.checksum = crc8(&pointing.report, sizeof(report_mouse_t));
+    // Motion adds up until the master reads it, however long the link takes to get to it
+    pointing_device_accumulate_motion(&motion);
 
+    // Only the motion is ours, the master may have written the session or CPI while the sensor was read
     split_shared_memory_lock();
-    memcpy(&split_shmem->pointing, &pointing, sizeof(split_slave_pointing_sync_t));
+    split_shmem->pointing.report.motion = motion;
+    // Now update the checksum given that the pointing has been written to
+    split_shmem->pointing.checksum = crc8(&split_shmem->pointing.report, sizeof(split_slave_pointing_report_t));
     split_shared_memory_unlock();
 }
 
 #    define TRANSACTIONS_POINTING_MASTER() TRANSACTION_HANDLER_MASTER(pointing)
 #    define TRANSACTIONS_POINTING_SLAVE() TRANSACTION_HANDLER_SLAVE(pointing)
-#    define TRANSACTIONS_POINTING_REGISTRATIONS [GET_POINTING_CHECKSUM] = trans_target2initiator_initializer(pointing.checksum), [GET_POINTING_DATA] = trans_target2initiator_initializer(pointing.report), [PUT_POINTING_CPI] = trans_initiator2target_initializer(pointing.cpi),
+#    define TRANSACTIONS_POINTING_REGISTRATIONS [GET_POINTING_CHECKSUM] = trans_target2initiator_initializer(pointing.checksum), [GET_POINTING_DATA] = trans_target2initiator_initializer(pointing.report), [PUT_POINTING_CPI] = trans_initiator2target_initializer(pointing.cpi), [PUT_POINTING_SESSION] = trans_initiator2target_initializer(pointing.report.session),
 
 #else // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 
@@ -844,7 +1171,7 @@ static void haptic_handlers_slave(matrix_row_t master_matrix[], matrix_row_t sla
 }
 
 // clang-format off
-#    define TRANSACTIONS_HAPTIC_MASTER() TRANSACTION_HANDLER_MASTER(haptic)
+#    define TRANSACTIONS_HAPTIC_MASTER() TRANSACTION_HANDLER_MASTER_DEFERRABLE(haptic)
 #    define TRANSACTIONS_HAPTIC_SLAVE() TRANSACTION_HANDLER_SLAVE(haptic)
 #    define TRANSACTIONS_HAPTIC_REGISTRATIONS [PUT_HAPTIC] = trans_initiator2target_initializer(haptic_sync),
 // clang-format on
@@ -873,7 +1200,7 @@ static void activity_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
 }
 
 // clang-format off
-#    define TRANSACTIONS_ACTIVITY_MASTER() TRANSACTION_HANDLER_MASTER(activity)
+#    define TRANSACTIONS_ACTIVITY_MASTER() TRANSACTION_HANDLER_MASTER_DEFERRABLE(activity)
 #    define TRANSACTIONS_ACTIVITY_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(activity)
 #    define TRANSACTIONS_ACTIVITY_REGISTRATIONS [PUT_ACTIVITY] = trans_initiator2target_initializer(activity_sync),
 // clang-format on
@@ -914,6 +1241,67 @@ static void detected_os_handlers_slave(matrix_row_t master_matrix[], matrix_row_
 
 #endif // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
 
+////////////////////////////////////////////////////
+// Slave notifications
+
+#ifdef SPLIT_NOTIFY_PIN
+
+static void notify_begin_master(void) {
+    static uint32_t last_keepalive = 0;
+
+    // Poll the slave when it pulls the line low, and at a low rate in case a change was missed
+    split_notify_idle = is_transport_connected() && gpio_read_pin(SPLIT_NOTIFY_PIN) && timer_elapsed32(last_keepalive) < SPLIT_NOTIFY_KEEPALIVE_MS;
+    if (!split_notify_idle) {
+        last_keepalive = timer_read32();
+    }
+}
+
+static bool notify_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    if (split_notify_idle) {
+        return true;
+    }
+
+    // Let the slave know what was received, it keeps the line low until that matches its own data.
+    // The checksums are taken over the data itself, so a read that failed its checksum is not acknowledged.
+    static uint32_t    last_update = 0;
+    split_notify_ack_t ack;
+    ack.matrix_checksum = crc8(split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
+#    ifdef ENCODER_ENABLE
+    ack.encoders_checksum = crc8(&split_shmem->encoders.events, sizeof(split_shmem->encoders.events));
+#    endif // ENCODER_ENABLE
+#    if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+    ack.pointing_checksum = crc8(&split_shmem->pointing.report, sizeof(split_slave_pointing_report_t));
+#    endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+    // Sent again while the line stays low, a failed write would otherwise only be repeated by the forced resync
+    bool mismatch = memcmp(&ack, &split_shmem->notify_ack, sizeof(ack)) != 0 || !gpio_read_pin(SPLIT_NOTIFY_PIN);
+    return send_if_condition(PUT_NOTIFY_ACK, &last_update, mismatch, &ack, sizeof(ack));
+}
+
+static void notify_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    bool pending = split_shmem->smatrix.checksum != split_shmem->notify_ack.matrix_checksum;
+#    ifdef ENCODER_ENABLE
+    pending |= split_shmem->encoders.checksum != split_shmem->notify_ack.encoders_checksum;
+#    endif // ENCODER_ENABLE
+#    if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+    pending |= split_shmem->pointing.checksum != split_shmem->notify_ack.pointing_checksum;
+#    endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+    gpio_write_pin(SPLIT_NOTIFY_PIN, !pending);
+}
+
+#    define TRANSACTIONS_NOTIFY_BEGIN_MASTER() notify_begin_master()
+#    define TRANSACTIONS_NOTIFY_MASTER() TRANSACTION_HANDLER_MASTER(notify)
+#    define TRANSACTIONS_NOTIFY_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(notify)
+#    define TRANSACTIONS_NOTIFY_REGISTRATIONS [PUT_NOTIFY_ACK] = trans_initiator2target_initializer(notify_ack),
+
+#else // SPLIT_NOTIFY_PIN
+
+#    define TRANSACTIONS_NOTIFY_BEGIN_MASTER()
+#    define TRANSACTIONS_NOTIFY_MASTER()
+#    define TRANSACTIONS_NOTIFY_SLAVE()
+#    define TRANSACTIONS_NOTIFY_REGISTRATIONS
+
+#endif // SPLIT_NOTIFY_PIN
+
 ////////////////////////////////////////////////////
 
 split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
@@ -938,12 +1326,14 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
     TRANSACTIONS_RGB_MATRIX_REGISTRATIONS
     TRANSACTIONS_WPM_REGISTRATIONS
     TRANSACTIONS_OLED_REGISTRATIONS
+    TRANSACTIONS_OLED_BUFFER_REGISTRATIONS
     TRANSACTIONS_ST7565_REGISTRATIONS
     TRANSACTIONS_POINTING_REGISTRATIONS
     TRANSACTIONS_WATCHDOG_REGISTRATIONS
     TRANSACTIONS_HAPTIC_REGISTRATIONS
     TRANSACTIONS_ACTIVITY_REGISTRATIONS
     TRANSACTIONS_DETECTED_OS_REGISTRATIONS
+    TRANSACTIONS_NOTIFY_REGISTRATIONS
 // clang-format on
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
@@ -955,9 +1345,12 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
 };
 
 bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    sync_budget_begin_loop();
+    TRANSACTIONS_NOTIFY_BEGIN_MASTER();
     TRANSACTIONS_SLAVE_MATRIX_MASTER();
     TRANSACTIONS_MASTER_MATRIX_MASTER();
     TRANSACTIONS_ENCODERS_MASTER();
+    TRANSACTIONS_POINTING_MASTER();
     TRANSACTIONS_SYNC_TIMER_MASTER();
     TRANSACTIONS_LAYER_STATE_MASTER();
     TRANSACTIONS_LED_STATE_MASTER();
@@ -969,11 +1362,12 @@ bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix
     TRANSACTIONS_WPM_MASTER();
     TRANSACTIONS_OLED_MASTER();
     TRANSACTIONS_ST7565_MASTER();
-    TRANSACTIONS_POINTING_MASTER();
     TRANSACTIONS_WATCHDOG_MASTER();
     TRANSACTIONS_HAPTIC_MASTER();
     TRANSACTIONS_ACTIVITY_MASTER();
     TRANSACTIONS_DETECTED_OS_MASTER();
+    TRANSACTIONS_OLED_BUFFER_MASTER();
+    TRANSACTIONS_NOTIFY_MASTER();
     return true;
 }
 
@@ -991,12 +1385,14 @@ void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[
     TRANSACTIONS_RGB_MATRIX_SLAVE();
     TRANSACTIONS_WPM_SLAVE();
     TRANSACTIONS_OLED_SLAVE();
+    TRANSACTIONS_OLED_BUFFER_SLAVE();
     TRANSACTIONS_ST7565_SLAVE();
     TRANSACTIONS_POINTING_SLAVE();
     TRANSACTIONS_WATCHDOG_SLAVE();
     TRANSACTIONS_HAPTIC_SLAVE();
     TRANSACTIONS_ACTIVITY_SLAVE();
     TRANSACTIONS_DETECTED_OS_SLAVE();
+    TRANSACTIONS_NOTIFY_SLAVE();
 }
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
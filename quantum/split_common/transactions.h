@@ -51,3 +51,37 @@ bool transaction_rpc_exec(int8_t transaction_id, uint8_t initiator2target_buffer
 
 #define transaction_rpc_send(transaction_id, initiator2target_buffer_size, initiator2target_buffer) transaction_rpc_exec(transaction_id, initiator2target_buffer_size, initiator2target_buffer, 0, NULL)
 #define transaction_rpc_recv(transaction_id, target2initiator_buffer_size, target2initiator_buffer) transaction_rpc_exec(transaction_id, 0, NULL, target2initiator_buffer_size, target2initiator_buffer)
+
+#if defined(SPLIT_SYNC_BUDGET_US) && defined(__AVR__)
+#    error "SPLIT_SYNC_BUDGET_US needs a microsecond timer, AVR only counts milliseconds"
+#endif // defined(SPLIT_SYNC_BUDGET_US) && defined(__AVR__)
+
+#if defined(SPLIT_SYNC_BUDGET_US) && !defined(SPLIT_TRANSACTION_STATS_ENABLE)
+#    define SPLIT_TRANSACTION_STATS_ENABLE
+#endif // defined(SPLIT_SYNC_BUDGET_US) && !defined(SPLIT_TRANSACTION_STATS_ENABLE)
+
+#ifdef SPLIT_TRANSACTION_STATS_ENABLE
+// Link usage of a single transaction, as measured on the master
+typedef struct _split_transaction_stats_t {
+    uint32_t count;    // completed transfers
+    uint32_t errors;   // failed transfers
+    uint32_t total_us; // time spent in all transfers, completed or not, pipelined writes included
+    uint32_t max_us;   // longest single transfer
+} split_transaction_stats_t;
+
+// Returns the statistics of a transaction id, or NULL for an invalid id
+const split_transaction_stats_t *split_transaction_stats(int8_t id);
+
+// Returns the moving average of the transport time spent per master loop
+uint32_t split_transaction_loop_us(void);
+
+void split_transaction_stats_reset(void);
+
+// Charges the wait for a pipelined write, confirmed while a later transaction runs, to the write
+void split_transaction_confirmed(int8_t id, uint32_t us);
+#endif // SPLIT_TRANSACTION_STATS_ENABLE
+
+#ifdef SPLIT_SYNC_BUDGET_US
+// Returns the current forced resync interval of low priority syncs, stretched or compressed to fit the budget
+uint32_t split_sync_throttle(void);
+#endif // SPLIT_SYNC_BUDGET_US
@@ -92,6 +92,9 @@ typedef struct _led_matrix_sync_t {
 typedef struct _rgb_matrix_sync_t {
     rgb_config_t rgb_matrix;
     bool         rgb_suspend_state;
+#    ifdef RGB_MATRIX_SPLIT_LOCKSTEP
+    uint16_t rgb_seed;
+#    endif // RGB_MATRIX_SPLIT_LOCKSTEP
 } rgb_matrix_sync_t;
 #endif // defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
 
@@ -106,12 +109,27 @@ typedef struct _split_mods_sync_t {
 } split_mods_sync_t;
 #endif // SPLIT_MODS_ENABLE
 
+#if defined(OLED_ENABLE) && defined(SPLIT_OLED_BUFFER_ENABLE)
+#    include "oled_driver.h"
+
+typedef struct _split_oled_buffer_sync_t {
+    uint8_t sequence;
+    uint8_t length;
+    uint8_t data[SPLIT_OLED_BUFFER_SIZE];
+} split_oled_buffer_sync_t;
+#endif // defined(OLED_ENABLE) && defined(SPLIT_OLED_BUFFER_ENABLE)
+
 #if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 #    include "pointing_device.h"
+typedef struct _split_slave_pointing_report_t {
+    pointing_device_motion_t motion;
+    uint8_t                  session; // set by the master, back to 0 whenever the slave starts over
+} split_slave_pointing_report_t;
+
 typedef struct _split_slave_pointing_sync_t {
-    uint8_t        checksum;
-    report_mouse_t report;
-    uint16_t       cpi;
+    uint8_t                       checksum;
+    split_slave_pointing_report_t report;
+    uint16_t                      cpi;
 } split_slave_pointing_sync_t;
 #endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 
@@ -132,6 +150,19 @@ typedef struct _split_slave_activity_sync_t {
 } split_slave_activity_sync_t;
 #endif // defined(SPLIT_ACTIVITY_ENABLE)
 
+#ifdef SPLIT_NOTIFY_PIN
+// Checksums of the slave data the master has last received
+typedef struct _split_notify_ack_t {
+    uint8_t matrix_checksum;
+#    ifdef ENCODER_ENABLE
+    uint8_t encoders_checksum;
+#    endif // ENCODER_ENABLE
+#    if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+    uint8_t pointing_checksum;
+#    endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+} split_notify_ack_t;
+#endif // SPLIT_NOTIFY_PIN
+
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 typedef struct _rpc_sync_info_t {
     uint8_t checksum;
@@ -192,7 +223,10 @@ typedef struct _split_shared_memory_t {
 
 #if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
     rgb_matrix_sync_t rgb_matrix_sync;
-#endif // defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
+#    ifdef RGB_MATRIX_SPLIT_LOCKSTEP
+    rgb_matrix_hits_t rgb_matrix_hits;
+#    endif // RGB_MATRIX_SPLIT_LOCKSTEP
+#endif     // defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
 
 #if defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
     uint8_t current_wpm;
@@ -202,6 +236,10 @@ typedef struct _split_shared_memory_t {
     uint8_t current_oled_state;
 #endif // defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE)
 
+#if defined(OLED_ENABLE) && defined(SPLIT_OLED_BUFFER_ENABLE)
+    split_oled_buffer_sync_t oled_buffer;
+#endif // defined(OLED_ENABLE) && defined(SPLIT_OLED_BUFFER_ENABLE)
+
 #if defined(ST7565_ENABLE) && defined(SPLIT_ST7565_ENABLE)
     uint8_t current_st7565_state;
 #endif // ST7565_ENABLE(OLED_ENABLE) && defined(SPLIT_ST7565_ENABLE)
@@ -222,6 +260,10 @@ typedef struct _split_shared_memory_t {
     split_slave_activity_sync_t activity_sync;
 #endif // defined(SPLIT_ACTIVITY_ENABLE)
 
+#ifdef SPLIT_NOTIFY_PIN
+    split_notify_ack_t notify_ack;
+#endif // SPLIT_NOTIFY_PIN
+
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
     rpc_sync_info_t rpc_info;
     uint8_t         rpc_m2s_buffer[RPC_M2S_BUFFER_SIZE];
@@ -32,6 +32,9 @@
 #include "timer.h"
 #include "wait.h"
 #include "version.h" // for QMK_BUILDDATE used in EEPROM magic
+#include "util.h"
+#include "crc.h"
+#include <string.h>
 
 #if defined(AUDIO_ENABLE)
 #    include "audio.h"
@@ -276,6 +279,96 @@ __attribute__((weak)) bool via_command_kb(uint8_t *data, uint8_t length) {
     return false;
 }
 
+#ifdef VIA_BULK_TRANSFER_ENABLE
+// Packet header: command ID, region, offset (2 bytes), byte count
+#    define VIA_BULK_HEADER_SIZE 5
+
+static uint16_t via_bulk_region_size(uint8_t region) {
+    switch (region) {
+        case id_bulk_region_keymap:
+            return dynamic_keymap_get_layer_count() * MATRIX_ROWS * MATRIX_COLS * 2;
+#    ifdef ENCODER_MAP_ENABLE
+        case id_bulk_region_encoders:
+            return dynamic_keymap_encoder_get_buffer_size();
+#    endif
+        case id_bulk_region_macros:
+            return dynamic_keymap_macro_get_buffer_size();
+        case id_bulk_region_switch_matrix:
+            return MATRIX_ROWS * ((MATRIX_COLS + 7) / 8);
+        default:
+            return 0;
+    }
+}
+
+static void via_bulk_read_region(uint8_t region, uint16_t offset, uint8_t size, uint8_t *data) {
+    switch (region) {
+        case id_bulk_region_keymap:
+            dynamic_keymap_get_buffer(offset, size, data);
+            break;
+#    ifdef ENCODER_MAP_ENABLE
+        case id_bulk_region_encoders:
+            dynamic_keymap_encoder_get_buffer(offset, size, data);
+            break;
+#    endif
+        case id_bulk_region_macros:
+            dynamic_keymap_macro_get_buffer(offset, size, data);
+            break;
+        case id_bulk_region_switch_matrix: {
+            // Same layout as id_switch_matrix_state, big-endian rows
+            const uint8_t row_bytes = (MATRIX_COLS + 7) / 8;
+            for (uint8_t i = 0; i < size; i++) {
+                uint8_t      row   = (offset + i) / row_bytes;
+                uint8_t      shift = (row_bytes - 1 - (offset + i) % row_bytes) * 8;
+                matrix_row_t value = matrix_get_row(row);
+                data[i]            = (value >> shift) & 0xFF;
+            }
+            break;
+        }
+    }
+}
+
+// Streams a whole region in as few packets as possible, instead of one round trip per 28 bytes
+static void via_bulk_read(uint8_t *data, uint8_t length) {
+    uint8_t  region      = data[1];
+    uint16_t offset      = (data[2] << 8) | data[3];
+    uint16_t size        = (data[4] << 8) | data[5];
+    uint16_t region_size = via_bulk_region_size(region);
+    uint8_t  chunk_size  = length - VIA_BULK_HEADER_SIZE;
+    uint16_t crc         = 0xFFFF;
+
+    if (region_size == 0) {
+        data[0] = id_unhandled;
+        raw_hid_send(data, length);
+        return;
+    }
+
+    uint16_t end = offset < region_size ? offset + MIN(size, region_size - offset) : offset;
+    while (offset < end) {
+        uint8_t count = MIN(chunk_size, end - offset);
+        data[2]       = offset >> 8;
+        data[3]       = offset & 0xFF;
+        data[4]       = count;
+        via_bulk_read_region(region, offset, count, &data[VIA_BULK_HEADER_SIZE]);
+        memset(&data[VIA_BULK_HEADER_SIZE + count], 0x00, chunk_size - count);
+        crc = crc16_update(crc, &data[VIA_BULK_HEADER_SIZE], count);
+        raw_hid_send(data, length);
+        offset += count;
+    }
+
+    // Trailer: end offset, no data, CRC of the data sent and the current generation
+    uint16_t generation = dynamic_keymap_get_generation();
+    data[2]             = offset >> 8;
+    data[3]             = offset & 0xFF;
+    data[4]             = 0;
+    data[5]             = crc >> 8;
+    data[6]             = crc & 0xFF;
+    data[7]             = generation >> 8;
+    data[8]             = generation & 0xFF;
+    memset(&data[9], 0x00, length - 9);
+    raw_hid_send(data, length);
+}
+#endif // VIA_BULK_TRANSFER_ENABLE
+
 void raw_hid_receive(uint8_t *data, uint8_t length) {
     uint8_t *command_id   = &(data[0]);
     uint8_t *command_data = &(data[1]);
@@ -447,6 +540,24 @@ void raw_hid_receive(uint8_t *data, uint8_t length) {
             dynamic_keymap_set_encoder(command_data[0], command_data[1], command_data[2] != 0, (command_data[3] << 8) | command_data[4]);
             break;
         }
+#endif
+#ifdef VIA_BULK_TRANSFER_ENABLE
+        case id_bulk_get_generation: {
+            uint16_t generation = dynamic_keymap_get_generation();
+            uint32_t uptime     = timer_read32();
+            command_data[0]     = generation >> 8;
+            command_data[1]     = generation & 0xFF;
+            command_data[2]     = (uptime >> 24) & 0xFF;
+            command_data[3]     = (uptime >> 16) & 0xFF;
+            command_data[4]     = (uptime >> 8) & 0xFF;
+            command_data[5]     = uptime & 0xFF;
+            break;
+        }
+        case id_bulk_read: {
+            // Sends its own packets
+            via_bulk_read(data, length);
+            return;
+        }
 #endif
         default: {
             // The command ID is not known
@@ -93,6 +93,8 @@ enum via_command_id {
     id_dynamic_keymap_set_buffer            = 0x13,
     id_dynamic_keymap_get_encoder           = 0x14,
     id_dynamic_keymap_set_encoder           = 0x15,
+    id_bulk_get_generation                  = 0x16, // VIA_BULK_TRANSFER_ENABLE only
+    id_bulk_read                            = 0x17, // VIA_BULK_TRANSFER_ENABLE only
     id_unhandled                            = 0xFF,
 };
 
@@ -104,6 +106,26 @@ enum via_keyboard_value_id {
     id_device_indication   = 0x05,
 };
 
+// Bulk transfer extension, enabled with VIA_BULK_TRANSFER_ENABLE.
+// Hosts detect it by sending id_bulk_get_generation and checking for id_unhandled.
+//
+// id_bulk_get_generation returns the dynamic keymap generation (2 bytes) followed by the
+// uptime (4 bytes). A host whose cached copy was read at the same generation, without the
+// uptime going backwards in between, does not need to read it again.
+//
+// id_bulk_read takes a region, a 16-bit offset and a 16-bit size, all big-endian, and answers
+// with as many packets as needed: region, offset (2 bytes), byte count, then up to 27 bytes of
+// data. The size is clamped to the end of the region, so 0xFFFF reads up to the end. The last
+// packet has a byte count of 0 and carries the end offset, the CRC16-CCITT (initial value
+// 0xFFFF) of every data byte sent for this request and the generation at the end of the
+// transfer. An interrupted transfer can be resumed by reading again from the last offset seen.
+enum via_bulk_region {
+    id_bulk_region_keymap        = 0x00,
+    id_bulk_region_encoders      = 0x01,
+    id_bulk_region_macros        = 0x02,
+    id_bulk_region_switch_matrix = 0x03,
+};
+
 enum via_channel_id {
     id_custom_channel         = 0,
     id_qmk_backlight_channel  = 1,
@@ -0,0 +1,182 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*******************************************************************************
+  88888888888 888      d8b                .d888 d8b 888               d8b
+      888     888      Y8P               d88P"  Y8P 888               Y8P
+      888     888                        888        888
+      888     88888b.  888 .d8888b       888888 888 888  .d88b.       888 .d8888b
+      888     888 "88b 888 88K           888    888 888 d8P  Y8b      888 88K
+      888     888  888 888 "Y8888b.      888    888 888 88888888      888 "Y8888b.
+      888     888  888 888      X88      888    888 888 Y8b.          888      X88
+      888     888  888 888  88888P'      888    888 888  "Y8888       888  88888P'
+                                                        888                 888
+                                                        888                 888
+                                                        888                 888
+     .d88b.   .d88b.  88888b.   .d88b.  888d888 8888b.  888888 .d88b.   .d88888
+    d88P"88b d8P  Y8b 888 "88b d8P  Y8b 888P"      "88b 888   d8P  Y8b d88" 888
+    888  888 88888888 888  888 88888888 888    .d888888 888   88888888 888  888
+    Y88b 888 Y8b.     888  888 Y8b.     888    888  888 Y88b. Y8b.     Y88b 888
+     "Y88888  "Y8888  888  888  "Y8888  888    "Y888888  "Y888 "Y8888   "Y88888
+         888
+    Y8b d88P
+     "Y88P"
+*******************************************************************************/
+
+#pragma once
+
+// Autocorrection dictionary (70 entries):
+//   :guage     -> gauge
+//   :the:the:  -> the
+//   :thier     -> their
+//   :ture      -> true
+//   accomodate -> accommodate
+//   acommodate -> accommodate
+//   aparent    -> apparent
+//   aparrent   -> apparent
+//   apparant   -> apparent
+//   apparrent  -> apparent
+//   aquire     -> acquire
+//   becuase    -> because
+//   cauhgt     -> caught
+//   cheif      -> chief
+//   choosen    -> chosen
+//   cieling    -> ceiling
+//   collegue   -> colleague
+//   concensus  -> consensus
+//   contians   -> contains
+//   cosnt      -> const
+//   dervied    -> derived
+//   fales      -> false
+//   fasle      -> false
+//   fitler     -> filter
+//   flase      -> false
+//   foward     -> forward
+//   frequecy   -> frequency
+//   gaurantee  -> guarantee
+//   guaratee   -> guarantee
+//   heigth     -> height
+//   heirarchy  -> hierarchy
+//   inclued    -> include
+//   interator  -> iterator
+//   intput     -> input
+//   invliad    -> invalid
+//   lenght     -> length
+//   liasion    -> liaison
+//   libary     -> library
+//   listner    -> listener
+//   looses:    -> loses
+//   looup      -> lookup
+//   manefist   -> manifest
+//   namesapce  -> namespace
+//   namespcae  -> namespace
+//   occassion  -> occasion
+//   occured    -> occurred
+//   ouptut     -> output
+//   ouput      -> output
+//   overide    -> override
+//   postion    -> position
+//   priviledge -> privilege
+//   psuedo     -> pseudo
+//   recieve    -> receive
+//   refered    -> referred
+//   relevent   -> relevant
+//   repitition -> repetition
+//   retrun     -> return
+//   retun      -> return
+//   reuslt     -> result
+//   reutrn     -> return
+//   saftey     -> safety
+//   seperate   -> separate
+//   singed     -> signed
+//   stirng     -> string
+//   strign     -> string
+//   swithc     -> switch
+//   swtich     -> switch
+//   thresold   -> threshold
+//   udpate     -> update
+//   widht      -> width
+
+#define AUTOCORRECT_MIN_LENGTH 5 // ":ture"
+#define AUTOCORRECT_MAX_LENGTH 10 // "accomodate"
+#define DICTIONARY_SIZE 1204
+#define AUTOCORRECT_LINK_SIZE 3
+
+static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {
+    0x6C, 0x39, 0x00, 0x00, 0x06, 0x57, 0x00, 0x00, 0x07, 0x61, 0x00, 0x00, 0x08, 0xE1, 0x00, 0x00,
+    0x09, 0x22, 0x02, 0x00, 0x0A, 0x2C, 0x02, 0x00, 0x0B, 0x4E, 0x02, 0x00, 0x11, 0x6B, 0x02, 0x00,
+    0x12, 0x01, 0x03, 0x00, 0x13, 0x0D, 0x03, 0x00, 0x15, 0x17, 0x03, 0x00, 0x16, 0x5C, 0x03, 0x00,
+    0x17, 0x8E, 0x03, 0x00, 0x1C, 0x70, 0x04, 0x00, 0x00, 0x48, 0x42, 0x00, 0x00, 0x16, 0x4C, 0x00,
+    0x00, 0x00, 0x0B, 0x17, 0x2C, 0x08, 0x0B, 0x17, 0x2C, 0x00, 0x84, 0x00, 0x08, 0x16, 0x12, 0x12,
+    0x0F, 0x00, 0x84, 0x73, 0x65, 0x73, 0x00, 0x0B, 0x17, 0x0C, 0x1A, 0x16, 0x00, 0x81, 0x63, 0x68,
+    0x00, 0x44, 0x72, 0x00, 0x00, 0x08, 0x7E, 0x00, 0x00, 0x0F, 0xC8, 0x00, 0x00, 0x15, 0xD5, 0x00,
+    0x00, 0x00, 0x0C, 0x0F, 0x19, 0x11, 0x0C, 0x00, 0x83, 0x61, 0x6C, 0x69, 0x64, 0x00, 0x4A, 0x8F,
+    0x00, 0x00, 0x0C, 0x99, 0x00, 0x00, 0x15, 0xA4, 0x00, 0x00, 0x18, 0xBF, 0x00, 0x00, 0x00, 0x11,
+    0x0C, 0x16, 0x00, 0x83, 0x67, 0x6E, 0x65, 0x64, 0x00, 0x19, 0x15, 0x08, 0x07, 0x00, 0x83, 0x69,
+    0x76, 0x65, 0x64, 0x00, 0x48, 0xAD, 0x00, 0x00, 0x18, 0xB6, 0x00, 0x00, 0x00, 0x09, 0x08, 0x15,
+    0x00, 0x81, 0x72, 0x65, 0x64, 0x00, 0x06, 0x06, 0x12, 0x00, 0x81, 0x72, 0x65, 0x64, 0x00, 0x0F,
+    0x06, 0x11, 0x0C, 0x00, 0x81, 0x64, 0x65, 0x00, 0x12, 0x16, 0x08, 0x15, 0x0B, 0x17, 0x00, 0x82,
+    0x68, 0x6F, 0x6C, 0x64, 0x00, 0x04, 0x1A, 0x12, 0x09, 0x00, 0x83, 0x72, 0x77, 0x61, 0x72, 0x64,
+    0x00, 0x44, 0x0E, 0x01, 0x00, 0x06, 0x1B, 0x01, 0x00, 0x07, 0x29, 0x01, 0x00, 0x08, 0x35, 0x01,
+    0x00, 0x0A, 0x5B, 0x01, 0x00, 0x0F, 0x7A, 0x01, 0x00, 0x15, 0x83, 0x01, 0x00, 0x16, 0xA0, 0x01,
+    0x00, 0x17, 0xBD, 0x01, 0x00, 0x18, 0x09, 0x02, 0x00, 0x19, 0x16, 0x02, 0x00, 0x00, 0x06, 0x13,
+    0x16, 0x08, 0x10, 0x04, 0x11, 0x00, 0x82, 0x61, 0x63, 0x65, 0x00, 0x13, 0x04, 0x16, 0x08, 0x10,
+    0x04, 0x11, 0x00, 0x83, 0x70, 0x61, 0x63, 0x65, 0x00, 0x0C, 0x15, 0x08, 0x19, 0x12, 0x00, 0x82,
+    0x72, 0x69, 0x64, 0x65, 0x00, 0x17, 0x00, 0x44, 0x40, 0x01, 0x00, 0x11, 0x4B, 0x01, 0x00, 0x00,
+    0x15, 0x04, 0x18, 0x0A, 0x00, 0x82, 0x6E, 0x74, 0x65, 0x65, 0x00, 0x04, 0x15, 0x18, 0x04, 0x0A,
+    0x00, 0x87, 0x75, 0x61, 0x72, 0x61, 0x6E, 0x74, 0x65, 0x65, 0x00, 0x44, 0x64, 0x01, 0x00, 0x07,
+    0x6E, 0x01, 0x00, 0x00, 0x18, 0x0A, 0x2C, 0x00, 0x83, 0x61, 0x75, 0x67, 0x65, 0x00, 0x08, 0x0F,
+    0x0C, 0x19, 0x0C, 0x15, 0x13, 0x00, 0x82, 0x67, 0x65, 0x00, 0x16, 0x04, 0x09, 0x00, 0x82, 0x6C,
+    0x73, 0x65, 0x00, 0x4C, 0x8C, 0x01, 0x00, 0x18, 0x98, 0x01, 0x00, 0x00, 0x18, 0x14, 0x04, 0x00,
+    0x84, 0x63, 0x71, 0x75, 0x69, 0x72, 0x65, 0x00, 0x17, 0x2C, 0x00, 0x82, 0x72, 0x75, 0x65, 0x00,
+    0x04, 0x00, 0x4F, 0xAB, 0x01, 0x00, 0x18, 0xB3, 0x01, 0x00, 0x00, 0x09, 0x00, 0x83, 0x61, 0x6C,
+    0x73, 0x65, 0x00, 0x06, 0x08, 0x05, 0x00, 0x83, 0x61, 0x75, 0x73, 0x65, 0x00, 0x04, 0x00, 0x47,
+    0xCC, 0x01, 0x00, 0x13, 0xF3, 0x01, 0x00, 0x15, 0xFD, 0x01, 0x00, 0x00, 0x12, 0x10, 0x00, 0x50,
+    0xD8, 0x01, 0x00, 0x12, 0xE7, 0x01, 0x00, 0x00, 0x12, 0x06, 0x04, 0x00, 0x87, 0x63, 0x6F, 0x6D,
+    0x6D, 0x6F, 0x64, 0x61, 0x74, 0x65, 0x00, 0x06, 0x06, 0x04, 0x00, 0x84, 0x6D, 0x6F, 0x64, 0x61,
+    0x74, 0x65, 0x00, 0x07, 0x18, 0x00, 0x84, 0x70, 0x64, 0x61, 0x74, 0x65, 0x00, 0x08, 0x13, 0x08,
+    0x16, 0x00, 0x84, 0x61, 0x72, 0x61, 0x74, 0x65, 0x00, 0x0A, 0x08, 0x0F, 0x0F, 0x12, 0x06, 0x00,
+    0x82, 0x61, 0x67, 0x75, 0x65, 0x00, 0x08, 0x0C, 0x06, 0x08, 0x15, 0x00, 0x83, 0x65, 0x69, 0x76,
+    0x65, 0x00, 0x0C, 0x08, 0x0B, 0x06, 0x00, 0x82, 0x69, 0x65, 0x66, 0x00, 0x11, 0x00, 0x4C, 0x37,
+    0x02, 0x00, 0x15, 0x44, 0x02, 0x00, 0x00, 0x0F, 0x08, 0x0C, 0x06, 0x00, 0x85, 0x65, 0x69, 0x6C,
+    0x69, 0x6E, 0x67, 0x00, 0x0C, 0x17, 0x16, 0x00, 0x83, 0x72, 0x69, 0x6E, 0x67, 0x00, 0x46, 0x57,
+    0x02, 0x00, 0x17, 0x62, 0x02, 0x00, 0x00, 0x0C, 0x17, 0x1A, 0x16, 0x00, 0x83, 0x69, 0x74, 0x63,
+    0x68, 0x00, 0x0A, 0x0C, 0x08, 0x0B, 0x00, 0x81, 0x68, 0x74, 0x00, 0x48, 0x80, 0x02, 0x00, 0x0A,
+    0x8B, 0x02, 0x00, 0x12, 0x94, 0x02, 0x00, 0x15, 0xDD, 0x02, 0x00, 0x18, 0xE8, 0x02, 0x00, 0x00,
+    0x16, 0x12, 0x12, 0x0B, 0x06, 0x00, 0x83, 0x73, 0x65, 0x6E, 0x00, 0x0C, 0x15, 0x17, 0x16, 0x00,
+    0x81, 0x6E, 0x67, 0x00, 0x0C, 0x00, 0x56, 0x9F, 0x02, 0x00, 0x17, 0xBB, 0x02, 0x00, 0x00, 0x44,
+    0xA8, 0x02, 0x00, 0x16, 0xB1, 0x02, 0x00, 0x00, 0x0C, 0x0F, 0x00, 0x83, 0x69, 0x73, 0x6F, 0x6E,
+    0x00, 0x04, 0x06, 0x06, 0x12, 0x00, 0x83, 0x69, 0x6F, 0x6E, 0x00, 0x4C, 0xC4, 0x02, 0x00, 0x16,
+    0xD3, 0x02, 0x00, 0x00, 0x17, 0x0C, 0x13, 0x08, 0x15, 0x00, 0x86, 0x65, 0x74, 0x69, 0x74, 0x69,
+    0x6F, 0x6E, 0x00, 0x12, 0x13, 0x00, 0x83, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x17, 0x18, 0x08,
+    0x15, 0x00, 0x83, 0x74, 0x75, 0x72, 0x6E, 0x00, 0x55, 0xF1, 0x02, 0x00, 0x17, 0xFA, 0x02, 0x00,
+    0x00, 0x17, 0x08, 0x15, 0x00, 0x82, 0x75, 0x72, 0x6E, 0x00, 0x08, 0x15, 0x00, 0x80, 0x72, 0x6E,
+    0x00, 0x07, 0x08, 0x18, 0x16, 0x13, 0x00, 0x83, 0x65, 0x75, 0x64, 0x6F, 0x00, 0x18, 0x12, 0x12,
+    0x0F, 0x00, 0x81, 0x6B, 0x75, 0x70, 0x00, 0x48, 0x20, 0x03, 0x00, 0x12, 0x4B, 0x03, 0x00, 0x00,
+    0x4C, 0x2D, 0x03, 0x00, 0x0F, 0x36, 0x03, 0x00, 0x11, 0x40, 0x03, 0x00, 0x00, 0x0B, 0x17, 0x2C,
+    0x00, 0x82, 0x65, 0x69, 0x72, 0x00, 0x17, 0x0C, 0x09, 0x00, 0x83, 0x6C, 0x74, 0x65, 0x72, 0x00,
+    0x17, 0x16, 0x0C, 0x0F, 0x00, 0x82, 0x65, 0x6E, 0x65, 0x72, 0x00, 0x17, 0x04, 0x15, 0x08, 0x17,
+    0x11, 0x0C, 0x00, 0x87, 0x74, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x00, 0x48, 0x69, 0x03, 0x00,
+    0x11, 0x71, 0x03, 0x00, 0x18, 0x7E, 0x03, 0x00, 0x00, 0x0F, 0x04, 0x09, 0x00, 0x81, 0x73, 0x65,
+    0x00, 0x04, 0x0C, 0x17, 0x11, 0x12, 0x06, 0x00, 0x83, 0x61, 0x69, 0x6E, 0x73, 0x00, 0x16, 0x11,
+    0x08, 0x06, 0x11, 0x12, 0x06, 0x00, 0x85, 0x73, 0x65, 0x6E, 0x73, 0x75, 0x73, 0x00, 0x4A, 0xA7,
+    0x03, 0x00, 0x0B, 0xB1, 0x03, 0x00, 0x0F, 0xC9, 0x03, 0x00, 0x11, 0xD4, 0x03, 0x00, 0x16, 0x36,
+    0x04, 0x00, 0x18, 0x44, 0x04, 0x00, 0x00, 0x0B, 0x18, 0x04, 0x06, 0x00, 0x82, 0x67, 0x68, 0x74,
+    0x00, 0x47, 0xBA, 0x03, 0x00, 0x0A, 0xC1, 0x03, 0x00, 0x00, 0x0C, 0x1A, 0x00, 0x81, 0x74, 0x68,
+    0x00, 0x11, 0x08, 0x0F, 0x00, 0x81, 0x74, 0x68, 0x00, 0x16, 0x18, 0x08, 0x15, 0x00, 0x83, 0x73,
+    0x75, 0x6C, 0x74, 0x00, 0x44, 0xE1, 0x03, 0x00, 0x08, 0xEC, 0x03, 0x00, 0x16, 0x2E, 0x04, 0x00,
+    0x00, 0x15, 0x04, 0x13, 0x13, 0x04, 0x00, 0x82, 0x65, 0x6E, 0x74, 0x00, 0x55, 0xF5, 0x03, 0x00,
+    0x19, 0x24, 0x04, 0x00, 0x00, 0x44, 0xFE, 0x03, 0x00, 0x15, 0x09, 0x04, 0x00, 0x00, 0x13, 0x04,
+    0x00, 0x84, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x00, 0x04, 0x13, 0x00, 0x44, 0x15, 0x04, 0x00,
+    0x13, 0x1D, 0x04, 0x00, 0x00, 0x85, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x00, 0x04, 0x00, 0x83,
+    0x65, 0x6E, 0x74, 0x00, 0x08, 0x0F, 0x08, 0x15, 0x00, 0x82, 0x61, 0x6E, 0x74, 0x00, 0x12, 0x06,
+    0x00, 0x82, 0x6E, 0x73, 0x74, 0x00, 0x0C, 0x09, 0x08, 0x11, 0x04, 0x10, 0x00, 0x84, 0x69, 0x66,
+    0x65, 0x73, 0x74, 0x00, 0x53, 0x4D, 0x04, 0x00, 0x17, 0x66, 0x04, 0x00, 0x00, 0x57, 0x56, 0x04,
+    0x00, 0x18, 0x5E, 0x04, 0x00, 0x00, 0x11, 0x0C, 0x00, 0x83, 0x70, 0x75, 0x74, 0x00, 0x12, 0x00,
+    0x82, 0x74, 0x70, 0x75, 0x74, 0x00, 0x13, 0x18, 0x12, 0x00, 0x83, 0x74, 0x70, 0x75, 0x74, 0x00,
+    0x46, 0x81, 0x04, 0x00, 0x08, 0x8D, 0x04, 0x00, 0x0B, 0x97, 0x04, 0x00, 0x15, 0xA9, 0x04, 0x00,
+    0x00, 0x08, 0x18, 0x14, 0x08, 0x15, 0x09, 0x00, 0x81, 0x6E, 0x63, 0x79, 0x00, 0x17, 0x09, 0x04,
+    0x16, 0x00, 0x82, 0x65, 0x74, 0x79, 0x00, 0x06, 0x15, 0x04, 0x15, 0x0C, 0x08, 0x0B, 0x00, 0x87,
+    0x69, 0x65, 0x72, 0x61, 0x72, 0x63, 0x68, 0x79, 0x00, 0x04, 0x05, 0x0C, 0x0F, 0x00, 0x82, 0x72,
+    0x61, 0x72, 0x79, 0x00
+};
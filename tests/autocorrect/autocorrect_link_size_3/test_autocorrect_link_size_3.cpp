@@ -0,0 +1,184 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstdio>
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "autocorrect_data.h"
+}
+
+static_assert(AUTOCORRECT_LINK_SIZE == 3, "The dictionary must be generated with --link-size 3");
+
+using ::testing::_;
+using ::testing::AnyNumber;
+using ::testing::InSequence;
+
+#define BENCHMARK_KEYSTROKES 1000000
+
+class AutoCorrectLinkSize3 : public TestFixture {
+   public:
+    void SetUp() override {
+        autocorrect_enable();
+    }
+    // Convenience function to tap `key`.
+    void TapKey(KeymapKey key) {
+        key.press();
+        run_one_scan_loop();
+        key.release();
+        run_one_scan_loop();
+    }
+
+    // Taps in order each key in `keys`.
+    template <typename... Ts>
+    void TapKeys(Ts... keys) {
+        for (KeymapKey key : {keys...}) {
+            TapKey(key);
+        }
+    }
+};
+
+// Test that typing "fales" autocorrects to "false"
+TEST_F(AutoCorrectLinkSize3, fales_to_false_autocorrection) {
+    TestDriver driver;
+    auto       key_f = KeymapKey(0, 0, 0, KC_F);
+    auto       key_a = KeymapKey(0, 1, 0, KC_A);
+    auto       key_l = KeymapKey(0, 2, 0, KC_L);
+    auto       key_e = KeymapKey(0, 3, 0, KC_E);
+    auto       key_s = KeymapKey(0, 4, 0, KC_S);
+
+    set_keymap({key_f, key_a, key_l, key_e, key_s});
+
+    // Allow any number of empty reports.
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport())).Times(AnyNumber());
+    { // Expect the following reports in this order.
+        InSequence s;
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_F)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_A)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_L)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_E)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_BACKSPACE)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_S)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_E)));
+    }
+
+    TapKeys(key_f, key_a, key_l, key_e, key_s);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+// Test that typing "apparant" autocorrects to "apparent", which follows links through three branch nodes
+TEST_F(AutoCorrectLinkSize3, apparant_to_apparent_autocorrection) {
+    TestDriver driver;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_p = KeymapKey(0, 1, 0, KC_P);
+    auto       key_r = KeymapKey(0, 2, 0, KC_R);
+    auto       key_n = KeymapKey(0, 3, 0, KC_N);
+    auto       key_t = KeymapKey(0, 4, 0, KC_T);
+
+    set_keymap({key_a, key_p, key_r, key_n, key_t});
+
+    // Allow any number of empty reports.
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport())).Times(AnyNumber());
+    { // Expect the following reports in this order.
+        InSequence s;
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_A)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_P))).Times(2);
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_A)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_R)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_A)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_N)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_BACKSPACE))).Times(2);
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_E)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_N)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_T)));
+    }
+
+    TapKeys(key_a, key_p, key_p, key_a, key_r, key_a, key_n, key_t);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+// Test that typing "ture" after a word break autocorrects to "true"
+TEST_F(AutoCorrectLinkSize3, ture_to_true_autocorrect) {
+    TestDriver driver;
+    auto       key_t_code = KeymapKey(0, 0, 0, KC_T);
+    auto       key_r      = KeymapKey(0, 1, 0, KC_R);
+    auto       key_u      = KeymapKey(0, 2, 0, KC_U);
+    auto       key_e      = KeymapKey(0, 3, 0, KC_E);
+    auto       key_space  = KeymapKey(0, 4, 0, KC_SPACE);
+
+    set_keymap({key_t_code, key_r, key_u, key_e, key_space});
+
+    // Allow any number of empty reports.
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport())).Times(AnyNumber());
+    { // Expect the following reports in this order.
+        InSequence s;
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_SPACE)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_T)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_U)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_R)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_BACKSPACE))).Times(2);
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_R)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_U)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_E)));
+    }
+
+    TapKeys(key_space, key_t_code, key_u, key_r, key_e);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+// Test that typing "overture" does not autocorrect
+TEST_F(AutoCorrectLinkSize3, overture_should_not_autocorrect) {
+    TestDriver driver;
+    auto       key_o      = KeymapKey(0, 0, 0, KC_O);
+    auto       key_v      = KeymapKey(0, 1, 0, KC_V);
+    auto       key_e      = KeymapKey(0, 2, 0, KC_E);
+    auto       key_r      = KeymapKey(0, 3, 0, KC_R);
+    auto       key_t_code = KeymapKey(0, 4, 0, KC_T);
+    auto       key_u      = KeymapKey(0, 5, 0, KC_U);
+
+    set_keymap({key_o, key_v, key_e, key_r, key_t_code, key_u});
+
+    // Allow any number of empty reports.
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport())).Times(AnyNumber());
+    { // Expect the following reports in this order.
+        InSequence s;
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_O)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_V)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_E)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_R)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_T)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_U)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_R)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_E)));
+    }
+
+    TapKeys(key_o, key_v, key_e, key_r, key_t_code, key_u, key_r, key_e);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+/* Prints how many keystrokes per second process_autocorrect() looks up with 3 byte node
+   links. tests/process_record_benchmark/autocorrect runs the same text against the default
+   dictionary with 2 byte links, compare the two figures. */
+TEST_F(AutoCorrectLinkSize3, LookupThroughput) {
+    static const char text[] = "the parent will receive a separate update and return the result in place of its output ";
+    keyrecord_t       record = {};
+    record.event.type        = KEY_EVENT;
+    record.event.pressed     = true;
+    unsigned passed          = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < BENCHMARK_KEYSTROKES; i++) {
+        char c = text[i % (sizeof(text) - 1)];
+        passed += process_autocorrect(c == ' ' ? KC_SPACE : KC_A + (c - 'a'), &record);
+    }
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    EXPECT_EQ(passed, BENCHMARK_KEYSTROKES);
+    printf("process_autocorrect, 3 byte links: %.0f keystrokes/s\n", BENCHMARK_KEYSTROKES / elapsed);
+}
@@ -0,0 +1,181 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+
+class DynamicMacro : public TestFixture {};
+
+TEST_F(DynamicMacro, plays_back_with_recorded_timing) {
+    TestDriver driver;
+
+    auto key_record = KeymapKey(0, 0, 0, QK_DYNAMIC_MACRO_RECORD_START_1);
+    auto key_stop   = KeymapKey(0, 1, 0, QK_DYNAMIC_MACRO_RECORD_STOP);
+    auto key_play   = KeymapKey(0, 2, 0, QK_DYNAMIC_MACRO_PLAY_1);
+    auto key_a      = KeymapKey(0, 3, 0, KC_A);
+    auto key_b      = KeymapKey(0, 4, 0, KC_B);
+
+    set_keymap({key_record, key_stop, key_play, key_a, key_b});
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    tap_key(key_record);
+    tap_key(key_a);
+    idle_for(200);
+    tap_key(key_b);
+    tap_key(key_stop);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_play);
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_TRUE(dynamic_macro_is_playing());
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(150);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(100);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_FALSE(dynamic_macro_is_playing());
+}
+
+TEST_F(DynamicMacro, playback_is_interruptible) {
+    TestDriver driver;
+
+    auto key_record = KeymapKey(0, 0, 0, QK_DYNAMIC_MACRO_RECORD_START_1);
+    auto key_stop   = KeymapKey(0, 1, 0, QK_DYNAMIC_MACRO_RECORD_STOP);
+    auto key_play   = KeymapKey(0, 2, 0, QK_DYNAMIC_MACRO_PLAY_1);
+    auto key_a      = KeymapKey(0, 3, 0, KC_A);
+    auto key_b      = KeymapKey(0, 4, 0, KC_B);
+
+    set_keymap({key_record, key_stop, key_play, key_a, key_b});
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    tap_key(key_record);
+    tap_key(key_a);
+    idle_for(200);
+    tap_key(key_b);
+    tap_key(key_stop);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_play);
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_stop);
+    EXPECT_FALSE(dynamic_macro_is_playing());
+    idle_for(300);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(DynamicMacro, playback_leaves_held_keys_and_layers_alone) {
+    TestDriver driver;
+
+    auto key_record = KeymapKey(0, 0, 0, QK_DYNAMIC_MACRO_RECORD_START_1);
+    auto key_stop   = KeymapKey(0, 1, 0, QK_DYNAMIC_MACRO_RECORD_STOP);
+    auto key_play   = KeymapKey(0, 2, 0, QK_DYNAMIC_MACRO_PLAY_1);
+    auto key_a      = KeymapKey(0, 3, 0, KC_A);
+    auto key_b      = KeymapKey(0, 4, 0, KC_B);
+    auto key_c      = KeymapKey(0, 5, 0, KC_C);
+    auto key_layer  = KeymapKey(0, 6, 0, MO(1));
+    auto key_play_1 = KeymapKey(1, 2, 0, KC_TRNS);
+    auto key_x      = KeymapKey(1, 3, 0, KC_X);
+
+    set_keymap({key_record, key_stop, key_play, key_a, key_b, key_c, key_layer, key_play_1, key_x});
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    tap_key(key_record);
+    tap_key(key_a);
+    idle_for(200);
+    tap_key(key_b);
+    tap_key(key_stop);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_C));
+    key_c.press();
+    run_one_scan_loop();
+    key_layer.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* The macro plays on the layer it was recorded on, next to the held key */
+    testing::InSequence s;
+    EXPECT_REPORT(driver, (KC_C, KC_A));
+    EXPECT_REPORT(driver, (KC_C));
+    EXPECT_REPORT(driver, (KC_C, KC_B));
+    EXPECT_REPORT(driver, (KC_C));
+    tap_key(key_play);
+    idle_for(300);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_FALSE(dynamic_macro_is_playing());
+    EXPECT_TRUE(layer_state_is(1));
+
+    /* Both are still held afterwards */
+    EXPECT_REPORT(driver, (KC_C, KC_X));
+    EXPECT_REPORT(driver, (KC_C));
+    tap_key(key_x);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_layer.release();
+    run_one_scan_loop();
+    key_c.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(DynamicMacro, interrupted_playback_only_releases_its_own_keys) {
+    TestDriver driver;
+
+    auto key_record = KeymapKey(0, 0, 0, QK_DYNAMIC_MACRO_RECORD_START_1);
+    auto key_stop   = KeymapKey(0, 1, 0, QK_DYNAMIC_MACRO_RECORD_STOP);
+    auto key_play   = KeymapKey(0, 2, 0, QK_DYNAMIC_MACRO_PLAY_1);
+    auto key_a      = KeymapKey(0, 3, 0, KC_A);
+    auto key_c      = KeymapKey(0, 5, 0, KC_C);
+
+    set_keymap({key_record, key_stop, key_play, key_a, key_c});
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    tap_key(key_record);
+    key_a.press();
+    run_one_scan_loop();
+    idle_for(200);
+    key_a.release();
+    run_one_scan_loop();
+    tap_key(key_stop);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_C));
+    EXPECT_REPORT(driver, (KC_C, KC_A));
+    key_c.press();
+    run_one_scan_loop();
+    tap_key(key_play);
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+
+    /* Stopping releases the macro's key, the user's stays down */
+    EXPECT_REPORT(driver, (KC_C));
+    tap_key(key_stop);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_FALSE(dynamic_macro_is_playing());
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_c.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,105 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include <utility>
+#include <vector>
+#include "test_common.hpp"
+
+extern "C" {
+#include "eeprom_driver.h"
+}
+
+/* The backend a custom EEPROM driver provides, recording every block written */
+static uint8_t                                backend[EEPROM_SIZE];
+static unsigned                               backend_reads;
+static std::vector<std::pair<size_t, size_t>> backend_writes;
+
+extern "C" void eeprom_driver_init(void) {}
+
+extern "C" void eeprom_driver_erase(void) {
+    memset(backend, 0, sizeof(backend));
+}
+
+extern "C" void eeprom_read_block(void *buf, const void *addr, size_t len) {
+    backend_reads++;
+    memcpy(buf, backend + (uintptr_t)addr, len);
+}
+
+extern "C" void eeprom_write_block(const void *buf, void *addr, size_t len) {
+    backend_writes.emplace_back((uintptr_t)addr, len);
+    memcpy(backend + (uintptr_t)addr, buf, len);
+}
+
+using Writes = std::vector<std::pair<size_t, size_t>>;
+
+class EepromDriver : public TestFixture {
+   public:
+    void SetUp() override {
+        for (size_t i = 0; i < sizeof(backend); i++) {
+            backend[i] = (uint8_t)(i * 7);
+        }
+        memcpy(data, backend, sizeof(data));
+        backend_reads = 0;
+        backend_writes.clear();
+    }
+
+    void update(size_t addr, size_t len) {
+        eeprom_update_block(data + addr, (void *)(uintptr_t)addr, len);
+        EXPECT_EQ(memcmp(backend, data, sizeof(data)), 0);
+    }
+
+    uint8_t data[EEPROM_SIZE];
+};
+
+TEST_F(EepromDriver, UnchangedBlockIsNotWritten) {
+    update(10, 100);
+    EXPECT_EQ(backend_writes, Writes{});
+    /* Compared in chunks of 32 bytes, the last one partial */
+    EXPECT_EQ(backend_reads, 4);
+}
+
+TEST_F(EepromDriver, OnlyTheDifferingSpanIsWritten) {
+    data[12] ^= 0xFF;
+    data[15] ^= 0xFF;
+    update(8, 24);
+    EXPECT_EQ(backend_writes, (Writes{{12, 4}}));
+}
+
+TEST_F(EepromDriver, DifferenceInAPartialChunk) {
+    data[65] ^= 0xFF;
+    data[68] ^= 0xFF;
+    update(0, 70);
+    EXPECT_EQ(backend_writes, (Writes{{65, 4}}));
+    EXPECT_EQ(backend_reads, 3);
+}
+
+TEST_F(EepromDriver, EachChunkWritesItsOwnSpan) {
+    data[103] ^= 0xFF;
+    data[105] ^= 0xFF;
+    data[140] ^= 0xFF;
+    update(100, 64);
+    EXPECT_EQ(backend_writes, (Writes{{103, 3}, {140, 1}}));
+}
+
+TEST_F(EepromDriver, SpanAcrossAChunkBoundaryIsSplit) {
+    for (size_t i = 30; i < 34; i++) {
+        data[i] ^= 0xFF;
+    }
+    update(0, 64);
+    EXPECT_EQ(backend_writes, (Writes{{30, 2}, {32, 2}}));
+}
+
+TEST_F(EepromDriver, EveryByteDifferent) {
+    for (size_t i = 0; i < 40; i++) {
+        data[200 + i] ^= 0xFF;
+    }
+    update(200, 40);
+    EXPECT_EQ(backend_writes, (Writes{{200, 32}, {232, 8}}));
+}
+
+TEST_F(EepromDriver, EmptyUpdateDoesNothing) {
+    update(0, 0);
+    EXPECT_EQ(backend_reads, 0);
+    EXPECT_EQ(backend_writes, Writes{});
+}
@@ -0,0 +1,45 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*******************************************************************************
+  88888888888 888      d8b                .d888 d8b 888               d8b
+      888     888      Y8P               d88P"  Y8P 888               Y8P
+      888     888                        888        888
+      888     88888b.  888 .d8888b       888888 888 888  .d88b.       888 .d8888b
+      888     888 "88b 888 88K           888    888 888 d8P  Y8b      888 88K
+      888     888  888 888 "Y8888b.      888    888 888 88888888      888 "Y8888b.
+      888     888  888 888      X88      888    888 888 Y8b.          888      X88
+      888     888  888 888  88888P'      888    888 888  "Y8888       888  88888P'
+                                                        888                 888
+                                                        888                 888
+                                                        888                 888
+     .d88b.   .d88b.  88888b.   .d88b.  888d888 8888b.  888888 .d88b.   .d88888
+    d88P"88b d8P  Y8b 888 "88b d8P  Y8b 888P"      "88b 888   d8P  Y8b d88" 888
+    888  888 88888888 888  888 88888888 888    .d888888 888   88888888 888  888
+    Y88b 888 Y8b.     888  888 Y8b.     888    888  888 Y88b. Y8b.     Y88b 888
+     "Y88888  "Y8888  888  888  "Y8888  888    "Y888888  "Y888 "Y8888   "Y88888
+         888
+    Y8b d88P
+     "Y88P"
+*******************************************************************************/
+
+#pragma once
+
+// Leader sequences (3 entries):
+//   KC_A      -> ONE
+//   KC_A KC_B -> TWO
+//   KC_C KC_D -> THREE
+
+enum leader_sequences {
+    LEADER_SEQ_ONE,
+    LEADER_SEQ_TWO,
+    LEADER_SEQ_THREE,
+};
+
+#ifdef LEADER_DATA_IMPLEMENTATION
+#    define LEADER_TRIE_SIZE 16
+
+static const uint16_t leader_trie[LEADER_TRIE_SIZE] PROGMEM = {
+    0x0002, KC_A, 5, KC_C, 11, 0x8001, 0, KC_B, 9, 0x8000, 1, 0x0001, KC_D, 14, 0x8000, 2
+};
+#endif
@@ -0,0 +1,19 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+#include "leader_data.h"
+
+void leader_end_user(void) {
+    switch (leader_sequence_match()) {
+        case LEADER_SEQ_ONE:
+            tap_code(KC_1);
+            break;
+        case LEADER_SEQ_TWO:
+            tap_code(KC_2);
+            break;
+        case LEADER_SEQ_THREE:
+            tap_code(KC_3);
+            break;
+    }
+}
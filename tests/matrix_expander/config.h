@@ -0,0 +1,12 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+/* The I2C expanders take up to 8 columns */
+#undef MATRIX_COLS
+#define MATRIX_COLS 8
+
+#define MATRIX_EXPANDER_RETRY_MS 100
@@ -0,0 +1,11 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# --------------------------------------------------------------------------------
+# Keep this file, even if it is empty, as a marker that this folder contains tests
+# --------------------------------------------------------------------------------
+
+# The MCP23018 is simulated by the test, so only the backend itself is built
+OPT_DEFS += -DMATRIX_EXPANDER_MCP23018
+COMMON_VPATH += $(DRIVER_PATH)/gpio
+SRC += $(QUANTUM_DIR)/matrix_expander.c
@@ -0,0 +1,160 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "matrix.h"
+#include "mcp23018.h"
+
+void matrix_init_custom(void);
+bool matrix_scan_custom(matrix_row_t current_matrix[]);
+void advance_time(uint32_t ms);
+}
+
+/* A simulated MCP23018, columns on port A, rows on port B, pressed keys pull their column low */
+static uint8_t sim_keys[MATRIX_ROWS];
+static uint8_t sim_port_b;
+static int     sim_reads_until_failure;
+static bool    sim_offline;
+static int     sim_reads;
+
+extern "C" void mcp23018_init(uint8_t slave_addr) {}
+
+extern "C" bool mcp23018_set_config(uint8_t slave_addr, mcp23018_port_t port, uint8_t conf) {
+    return !sim_offline;
+}
+
+extern "C" bool mcp23018_set_interrupt(uint8_t slave_addr, mcp23018_port_t port, uint8_t mask) {
+    return !sim_offline;
+}
+
+extern "C" bool mcp23018_set_output(uint8_t slave_addr, mcp23018_port_t port, uint8_t conf) {
+    if (sim_offline) {
+        return false;
+    }
+    if (port == mcp23018_PORTB) {
+        sim_port_b = conf;
+    }
+    return true;
+}
+
+extern "C" bool mcp23018_read_pins(uint8_t slave_addr, mcp23018_port_t port, uint8_t *ret) {
+    if (sim_reads_until_failure == 0) {
+        sim_offline = true;
+    }
+    if (sim_offline) {
+        return false;
+    }
+    if (sim_reads_until_failure > 0) {
+        sim_reads_until_failure--;
+    }
+    sim_reads++;
+
+    uint8_t cols = 0;
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        if (!(sim_port_b & (1 << row))) {
+            cols |= sim_keys[row];
+        }
+    }
+    *ret = ~cols;
+    return true;
+}
+
+class MatrixExpander : public testing::Test {
+   public:
+    void SetUp() override {
+        memset(sim_keys, 0, sizeof(sim_keys));
+        memset(current_matrix, 0, sizeof(current_matrix));
+        sim_port_b              = 0xFF;
+        sim_reads_until_failure = -1;
+        sim_offline             = false;
+        sim_reads               = 0;
+        matrix_init_custom();
+    }
+
+    matrix_row_t current_matrix[MATRIX_ROWS];
+};
+
+TEST_F(MatrixExpander, ReadsPressedKeys) {
+    sim_keys[1] = 1 << 2;
+
+    EXPECT_TRUE(matrix_scan_custom(current_matrix));
+    EXPECT_EQ(current_matrix[0], 0);
+    EXPECT_EQ(current_matrix[1], 1 << 2);
+
+    EXPECT_FALSE(matrix_scan_custom(current_matrix));
+    EXPECT_EQ(current_matrix[1], 1 << 2);
+
+    sim_keys[1] = 0;
+    EXPECT_TRUE(matrix_scan_custom(current_matrix));
+    EXPECT_EQ(current_matrix[1], 0);
+}
+
+TEST_F(MatrixExpander, IdleScanIsASingleRead) {
+    EXPECT_FALSE(matrix_scan_custom(current_matrix));
+    EXPECT_EQ(sim_reads, 1);
+
+    /* A key down selects the rows one by one, releasing it goes back to the single read */
+    sim_keys[2] = 1 << 0;
+    sim_reads   = 0;
+    EXPECT_TRUE(matrix_scan_custom(current_matrix));
+    EXPECT_EQ(sim_reads, 1 + MATRIX_ROWS);
+
+    sim_keys[2] = 0;
+    EXPECT_TRUE(matrix_scan_custom(current_matrix));
+    sim_reads = 0;
+    EXPECT_FALSE(matrix_scan_custom(current_matrix));
+    EXPECT_EQ(sim_reads, 1);
+}
+
+TEST_F(MatrixExpander, FailedReadReleasesHeldKeys) {
+    sim_keys[0] = 1 << 1;
+    sim_keys[3] = 1 << 5;
+    EXPECT_TRUE(matrix_scan_custom(current_matrix));
+    EXPECT_EQ(current_matrix[0], 1 << 1);
+    EXPECT_EQ(current_matrix[3], 1 << 5);
+
+    sim_reads_until_failure = 0;
+    EXPECT_TRUE(matrix_scan_custom(current_matrix));
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        EXPECT_EQ(current_matrix[row], 0) << "row " << +row;
+    }
+
+    /* Nothing is pressed again until the expander is set up again */
+    EXPECT_FALSE(matrix_scan_custom(current_matrix));
+    EXPECT_EQ(current_matrix[3], 0);
+}
+
+TEST_F(MatrixExpander, FailureMidScanReportsTheRowsAlreadyRead) {
+    sim_keys[0] = 1 << 1;
+    sim_keys[3] = 1 << 5;
+    EXPECT_TRUE(matrix_scan_custom(current_matrix));
+
+    /* Row 0 reads as released, then the expander goes away while row 2 is read */
+    sim_keys[0]             = 0;
+    sim_reads_until_failure = 2;
+    EXPECT_TRUE(matrix_scan_custom(current_matrix));
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        EXPECT_EQ(current_matrix[row], 0) << "row " << +row;
+    }
+}
+
+TEST_F(MatrixExpander, KeysAreReadAgainAfterReconnect) {
+    sim_keys[3] = 1 << 5;
+    EXPECT_TRUE(matrix_scan_custom(current_matrix));
+
+    sim_reads_until_failure = 0;
+    EXPECT_TRUE(matrix_scan_custom(current_matrix));
+    EXPECT_EQ(current_matrix[3], 0);
+
+    sim_offline             = false;
+    sim_reads_until_failure = -1;
+    EXPECT_FALSE(matrix_scan_custom(current_matrix));
+    EXPECT_EQ(current_matrix[3], 0);
+
+    advance_time(MATRIX_EXPANDER_RETRY_MS);
+    EXPECT_TRUE(matrix_scan_custom(current_matrix));
+    EXPECT_EQ(current_matrix[3], 1 << 5);
+}
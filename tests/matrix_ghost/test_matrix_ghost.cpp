@@ -0,0 +1,94 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+/* Ghost detection reads the keymap directly, point it at the per-test keymap instead */
+extern "C" uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column) {
+    return keymap_key_to_keycode(layer_num, (keypos_t){.col = column, .row = row});
+}
+
+class MatrixGhost : public TestFixture {};
+
+TEST_F(MatrixGhost, RowSharingTwoColumnsWithAnotherRowIsIgnored) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_b = KeymapKey(0, 1, 0, KC_B);
+    auto       key_c = KeymapKey(0, 0, 1, KC_C);
+    auto       key_d = KeymapKey(0, 1, 1, KC_D);
+
+    set_keymap({key_a, key_b, key_c, key_d});
+
+    key_a.press();
+    key_b.press();
+    EXPECT_REPORT(driver, (key_a.report_code));
+    EXPECT_REPORT(driver, (key_a.report_code, key_b.report_code));
+    keyboard_task();
+
+    key_c.press();
+    EXPECT_REPORT(driver, (key_a.report_code, key_b.report_code, key_c.report_code));
+    keyboard_task();
+
+    /* Columns 0 and 1 are now down on both rows, so the row of the new key is ignored */
+    key_d.press();
+    EXPECT_NO_REPORT(driver);
+    keyboard_task();
+    VERIFY_AND_CLEAR(driver);
+
+    key_d.release();
+    EXPECT_NO_REPORT(driver);
+    keyboard_task();
+
+    key_a.release();
+    key_b.release();
+    key_c.release();
+    EXPECT_REPORT(driver, (key_b.report_code, key_c.report_code));
+    EXPECT_REPORT(driver, (key_c.report_code));
+    EXPECT_EMPTY_REPORT(driver);
+    keyboard_task();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MatrixGhost, BlankKeysDoNotCauseGhosting) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a     = KeymapKey(0, 0, 0, KC_A);
+    auto       key_b     = KeymapKey(0, 1, 0, KC_B);
+    auto       key_c     = KeymapKey(0, 0, 1, KC_C);
+    auto       key_blank = KeymapKey(0, 1, 1, KC_NO);
+    auto       key_d     = KeymapKey(0, 2, 1, KC_D);
+
+    set_keymap({key_a, key_b, key_c, key_blank, key_d});
+
+    key_a.press();
+    key_b.press();
+    EXPECT_REPORT(driver, (key_a.report_code));
+    EXPECT_REPORT(driver, (key_a.report_code, key_b.report_code));
+    keyboard_task();
+
+    /* Only column 0 is shared with real keys, the blank on column 1 is filtered out */
+    key_c.press();
+    key_blank.press();
+    key_d.press();
+    EXPECT_REPORT(driver, (key_a.report_code, key_b.report_code, key_c.report_code));
+    EXPECT_REPORT(driver, (key_a.report_code, key_b.report_code, key_c.report_code, key_d.report_code));
+    keyboard_task();
+    VERIFY_AND_CLEAR(driver);
+
+    key_a.release();
+    key_b.release();
+    key_c.release();
+    key_blank.release();
+    key_d.release();
+    EXPECT_REPORT(driver, (key_b.report_code, key_c.report_code, key_d.report_code));
+    EXPECT_REPORT(driver, (key_c.report_code, key_d.report_code));
+    EXPECT_REPORT(driver, (key_d.report_code));
+    EXPECT_EMPTY_REPORT(driver);
+    keyboard_task();
+    VERIFY_AND_CLEAR(driver);
+}
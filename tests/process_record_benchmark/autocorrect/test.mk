@@ -0,0 +1,10 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# --------------------------------------------------------------------------------
+# Keep this file, even if it is empty, as a marker that this folder contains tests
+# --------------------------------------------------------------------------------
+
+# Uses the default dictionary, tests/autocorrect/autocorrect_link_size_3 runs the
+# same lookup benchmark against it with 3 byte links
+AUTOCORRECT_ENABLE = yes
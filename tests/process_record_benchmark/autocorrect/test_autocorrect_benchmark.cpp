@@ -0,0 +1,37 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstdio>
+#include "keycode.h"
+#include "test_common.hpp"
+
+#define BENCHMARK_KEYSTROKES 1000000
+
+class AutocorrectBenchmark : public TestFixture {
+   public:
+    void SetUp() override {
+        autocorrect_enable();
+    }
+};
+
+/* Prints how many keystrokes per second process_autocorrect() looks up in the default
+   dictionary, which has 2 byte node links. The text has no typos but shares many endings
+   with them, so most keystrokes walk a few nodes into the trie. */
+TEST_F(AutocorrectBenchmark, LookupThroughput) {
+    static const char text[] = "the parent will receive a separate update and return the result in place of its output ";
+    keyrecord_t       record = {};
+    record.event.type        = KEY_EVENT;
+    record.event.pressed     = true;
+    unsigned passed          = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < BENCHMARK_KEYSTROKES; i++) {
+        char c = text[i % (sizeof(text) - 1)];
+        passed += process_autocorrect(c == ' ' ? KC_SPACE : KC_A + (c - 'a'), &record);
+    }
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    EXPECT_EQ(passed, BENCHMARK_KEYSTROKES);
+    printf("process_autocorrect, 2 byte links: %.0f keystrokes/s\n", BENCHMARK_KEYSTROKES / elapsed);
+}
@@ -0,0 +1,14 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+/* A large converter matrix */
+#undef MATRIX_ROWS
+#define MATRIX_ROWS 16
+#undef MATRIX_COLS
+#define MATRIX_COLS 24
+
+#define MATRIX_HAS_GHOST
@@ -0,0 +1,70 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstdio>
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+
+#define BENCHMARK_SCANS 200000
+
+/* Ghost detection only counts keys that are mapped, treat every position as one */
+extern "C" uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column) {
+    return KC_A;
+}
+
+/* Keep the action pipeline out of the figures, only the scan path is measured */
+extern "C" bool should_process_keypress(void) {
+    return false;
+}
+
+class MatrixGhostBenchmark : public TestFixture {
+   public:
+    void SetUp() override {
+        /* Two keys down on every other row, no two rows share a column, so nothing is ghosted */
+        for (uint8_t row = 0; row < MATRIX_ROWS; row += 2) {
+            press_key(row, row);
+            press_key(row + 1, row);
+        }
+    }
+};
+
+/* Prints how many keyboard_task() calls per second a 16x24 matrix takes when every scan
+   changes one key on a row that holds two more, while 16 keys are held in total. That runs
+   change extraction and the ghost check against every other row each time. Only correctness
+   is asserted, the figure depends on the host. */
+TEST_F(MatrixGhostBenchmark, ChangedScanThroughput) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    keyboard_task();
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < BENCHMARK_SCANS / 2; i++) {
+        press_key(MATRIX_COLS - 1, MATRIX_ROWS - 2);
+        keyboard_task();
+        release_key(MATRIX_COLS - 1, MATRIX_ROWS - 2);
+        keyboard_task();
+    }
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    VERIFY_AND_CLEAR(driver);
+
+    printf("16x24 matrix, one change per scan: %.0f scans/s\n", BENCHMARK_SCANS / elapsed);
+}
+
+/* The same matrix without changes, which only compares the rows. */
+TEST_F(MatrixGhostBenchmark, IdleScanThroughput) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    keyboard_task();
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < BENCHMARK_SCANS; i++) {
+        keyboard_task();
+    }
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    VERIFY_AND_CLEAR(driver);
+
+    printf("16x24 matrix, no change: %.0f scans/s\n", BENCHMARK_SCANS / elapsed);
+}
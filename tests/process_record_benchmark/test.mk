@@ -0,0 +1,13 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# --------------------------------------------------------------------------------
+# Keep this file, even if it is empty, as a marker that this folder contains tests
+# --------------------------------------------------------------------------------
+
+# Handlers gated on their keycode block in process_record_quantum()
+MAGIC_ENABLE = yes
+GRAVE_ESC_ENABLE = yes
+TRI_LAYER_ENABLE = yes
+DYNAMIC_TAPPING_TERM_ENABLE = yes
+PROGRAMMABLE_BUTTON_ENABLE = yes
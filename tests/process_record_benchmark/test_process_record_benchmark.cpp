@@ -0,0 +1,42 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstdio>
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "action.h"
+}
+
+#define BENCHMARK_EVENTS 1000000
+
+class ProcessRecordBenchmark : public TestFixture {};
+
+/* Prints how many events per second process_record_quantum() handles for a basic keycode,
+   which is the case the keycode block gating speeds up. Only correctness is asserted, the
+   figure depends on the host. */
+TEST_F(ProcessRecordBenchmark, BasicKeycodeThroughput) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key});
+
+    keyrecord_t press     = {};
+    press.event.type      = KEY_EVENT;
+    press.event.pressed   = true;
+    keyrecord_t release   = press;
+    release.event.pressed = false;
+    unsigned    passed    = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < BENCHMARK_EVENTS / 2; i++) {
+        passed += process_record_quantum(&press);
+        passed += process_record_quantum(&release);
+    }
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    EXPECT_EQ(passed, BENCHMARK_EVENTS);
+    printf("process_record_quantum: %.0f events/s\n", BENCHMARK_EVENTS / elapsed);
+}
@@ -0,0 +1,14 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+/* A full size board with the default four dynamic layers */
+#undef MATRIX_ROWS
+#define MATRIX_ROWS 6
+#undef MATRIX_COLS
+#define MATRIX_COLS 21
+
+#define EEPROM_SIZE 2048
@@ -0,0 +1,114 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstdio>
+#include <string.h>
+#include "test_common.hpp"
+
+extern "C" {
+#include "eeprom_driver.h"
+#include "dynamic_keymap.h"
+}
+
+/* VIA moves the keymap in packets of at most 28 bytes */
+#define VIA_BUFFER_CHUNK 28
+
+/* The backend a custom EEPROM driver provides. On I2C, SPI and wear leveling backends every
+   call is a bus transaction or a log entry, so the call counts are what the figures show. */
+static uint8_t  backend[EEPROM_SIZE];
+static unsigned backend_reads;
+static unsigned backend_writes;
+
+extern "C" void eeprom_driver_init(void) {}
+
+extern "C" void eeprom_driver_erase(void) {
+    memset(backend, 0, sizeof(backend));
+}
+
+extern "C" void eeprom_read_block(void *buf, const void *addr, size_t len) {
+    backend_reads++;
+    memcpy(buf, backend + (uintptr_t)addr, len);
+}
+
+extern "C" void eeprom_write_block(const void *buf, void *addr, size_t len) {
+    backend_writes++;
+    memcpy(backend + (uintptr_t)addr, buf, len);
+}
+
+/* The byte at a time buffer accessors dynamic_keymap.c used before, for comparison */
+static void bytewise_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
+    uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
+    uint8_t *source                     = (uint8_t *)dynamic_keymap_key_to_eeprom_address(0, 0, 0) + offset;
+    for (uint16_t i = 0; i < size; i++) {
+        data[i] = offset + i < dynamic_keymap_eeprom_size ? eeprom_read_byte(source + i) : 0x00;
+    }
+}
+
+static void bytewise_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
+    uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
+    uint8_t *target                     = (uint8_t *)dynamic_keymap_key_to_eeprom_address(0, 0, 0) + offset;
+    for (uint16_t i = 0; i < size; i++) {
+        if (offset + i < dynamic_keymap_eeprom_size) {
+            eeprom_update_byte(target + i, data[i]);
+        }
+    }
+}
+
+typedef void (*buffer_fn_t)(uint16_t offset, uint16_t size, uint8_t *data);
+
+static const uint16_t keymap_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
+
+class ViaKeymapBenchmark : public TestFixture {
+   public:
+    void SetUp() override {
+        dynamic_keymap_reset();
+        for (uint16_t i = 0; i < keymap_size; i++) {
+            keymap[i] = (uint8_t)(i * 13 + 1);
+        }
+    }
+
+    /* Moves the whole keymap through `fn` the way VIA does, and prints what it cost */
+    void transfer(const char *name, buffer_fn_t fn) {
+        backend_reads  = 0;
+        backend_writes = 0;
+
+        auto start = std::chrono::steady_clock::now();
+        for (uint16_t offset = 0; offset < keymap_size; offset += VIA_BUFFER_CHUNK) {
+            fn(offset, MIN(VIA_BUFFER_CHUNK, keymap_size - offset), keymap + offset);
+        }
+        auto elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+        printf("%-24s %4u backend reads, %4u backend writes, %6.1fus\n", name, backend_reads, backend_writes, elapsed);
+    }
+
+    uint8_t keymap[keymap_size];
+};
+
+/* Prints the backend calls and host time of uploading and downloading a full 6x21 keymap of
+   four layers. Only correctness and that the block accessors need fewer calls are asserted. */
+TEST_F(ViaKeymapBenchmark, FullKeymapUploadAndDownload) {
+    transfer("upload, byte at a time", bytewise_set_buffer);
+    const unsigned bytewise_upload = backend_reads + backend_writes;
+    dynamic_keymap_reset();
+    transfer("upload, blocks", dynamic_keymap_set_buffer);
+    const unsigned block_upload = backend_reads + backend_writes;
+    EXPECT_LT(block_upload, bytewise_upload);
+
+    uint8_t expected[keymap_size];
+    memcpy(expected, keymap, sizeof(expected));
+
+    memset(keymap, 0, sizeof(keymap));
+    transfer("download, byte at a time", bytewise_get_buffer);
+    const unsigned bytewise_download = backend_reads;
+    EXPECT_EQ(memcmp(keymap, expected, sizeof(keymap)), 0);
+
+    memset(keymap, 0, sizeof(keymap));
+    transfer("download, blocks", dynamic_keymap_get_buffer);
+    EXPECT_EQ(memcmp(keymap, expected, sizeof(keymap)), 0);
+    EXPECT_LT(backend_reads, bytewise_download);
+
+    /* Uploading the same keymap again compares, but writes nothing */
+    transfer("upload unchanged, blocks", dynamic_keymap_set_buffer);
+    EXPECT_EQ(backend_writes, 0);
+}
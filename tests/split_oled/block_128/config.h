@@ -0,0 +1,12 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+/* 128x64, 8 blocks of 128 bytes */
+#define SPLIT_OLED_BUFFER_ENABLE
+#define OLED_UPDATE_INTERVAL 0
+#define OLED_DISPLAY_128X64
+#define OLED_BLOCK_TYPE uint8_t
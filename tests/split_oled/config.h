@@ -0,0 +1,14 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define FORCED_SYNC_THROTTLE_MS 100
+#define SPLIT_CONNECTION_CHECK_TIMEOUT 500
+
+/* 128x32, 16 blocks of 32 bytes */
+#define SPLIT_OLED_BUFFER_ENABLE
+#define OLED_UPDATE_INTERVAL 0
+#define SPLIT_OLED_BUFFER_INTERVAL 5
@@ -0,0 +1,133 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/* Round trips of the slave framebuffer encoding, shared by the suites of each block size */
+
+#pragma once
+
+#include <random>
+#include "test_common.hpp"
+
+extern "C" {
+#include "oled_driver.h"
+}
+
+/* What oled_task_user() draws into the slave's framebuffer, the master's own stays blank */
+static uint8_t remote_frame[OLED_MATRIX_SIZE];
+
+extern "C" {
+bool oled_task_user(void) {
+    if (is_oled_remote()) {
+        oled_write_raw((const char *)remote_frame, sizeof(remote_frame));
+    }
+    return false;
+}
+
+/* No panel attached */
+void oled_driver_init(void) {}
+bool oled_send_cmd(const uint8_t *data, uint16_t size) {
+    return true;
+}
+bool oled_send_data(const uint8_t *data, uint16_t size) {
+    return true;
+}
+}
+
+class OledRemoteCodec : public TestFixture {
+   public:
+    OledRemoteCodec() {
+        oled_clear();
+        oled_remote_invalidate();
+    }
+
+    /* Draws `frame` for the slave and decodes every chunk the master would send into the
+       local framebuffer, which then stands in for the slave's */
+    void round_trip(const uint8_t *frame) {
+        memcpy(remote_frame, frame, sizeof(remote_frame));
+        oled_task();
+
+        chunks = 0;
+        bytes  = 0;
+        uint8_t chunk[SPLIT_OLED_BUFFER_SIZE];
+        for (uint8_t length; (length = oled_remote_encode(chunk, sizeof(chunk))) != 0;) {
+            ASSERT_LE(length, sizeof(chunk));
+            ASSERT_LE(++chunks, OLED_BLOCK_COUNT);
+            bytes += length;
+            oled_remote_decode(chunk, length);
+        }
+        EXPECT_EQ(memcmp(oled_read_raw(0).current_element, frame, OLED_MATRIX_SIZE), 0);
+    }
+
+    uint16_t chunks;
+    uint16_t bytes;
+    uint8_t  frame[OLED_MATRIX_SIZE];
+};
+
+TEST_F(OledRemoteCodec, BlankFrame) {
+    memset(frame, 0, sizeof(frame));
+    round_trip(frame);
+    /* Two bytes per run of up to 129, plus the block index */
+    EXPECT_EQ(bytes, OLED_BLOCK_COUNT * (1 + (OLED_BLOCK_SIZE + 128) / 129 * 2));
+}
+
+TEST_F(OledRemoteCodec, NoRunsFrame) {
+    for (uint16_t i = 0; i < sizeof(frame); i++) {
+        frame[i] = i * 7 + i / 256;
+    }
+    round_trip(frame);
+    /* Worst case, every block takes a chunk of its own */
+    EXPECT_EQ(chunks, OLED_BLOCK_COUNT);
+    EXPECT_EQ(bytes, OLED_BLOCK_COUNT * (1 + OLED_BLOCK_SIZE + (OLED_BLOCK_SIZE + 127) / 128));
+}
+
+TEST_F(OledRemoteCodec, RunsOfEveryLength) {
+    /* Runs from 1 to 140 bytes, separated by single literals, crossing block boundaries */
+    uint16_t i = 0;
+    for (uint16_t run = 1; i < sizeof(frame); run = run % 140 + 1) {
+        for (uint16_t n = 0; n < run && i < sizeof(frame); n++) {
+            frame[i++] = run;
+        }
+        if (i < sizeof(frame)) {
+            frame[i++] = 0xff - run;
+        }
+    }
+    round_trip(frame);
+}
+
+TEST_F(OledRemoteCodec, RandomFrames) {
+    std::mt19937 random(OLED_BLOCK_SIZE);
+    for (int pass = 0; pass < 20; pass++) {
+        /* Few distinct values, so short and long runs both show up */
+        for (uint16_t i = 0; i < sizeof(frame); i++) {
+            frame[i] = random() % (pass % 4 + 2);
+        }
+        round_trip(frame);
+    }
+}
+
+TEST_F(OledRemoteCodec, OnlyChangedBlocksAreSent) {
+    memset(frame, 0x55, sizeof(frame));
+    round_trip(frame);
+
+    frame[OLED_BLOCK_SIZE * 2 + 3] = 0xaa;
+    round_trip(frame);
+    EXPECT_EQ(chunks, 1);
+
+    /* Nothing changed, nothing to send */
+    round_trip(frame);
+    EXPECT_EQ(chunks, 0);
+}
+
+TEST_F(OledRemoteCodec, MalformedChunksAreIgnored) {
+    memset(frame, 0x55, sizeof(frame));
+    round_trip(frame);
+
+    /* A run past the end of the block, a literal past the end of the data and an unknown block */
+    const uint8_t past_block[]    = {0, 0x7E + 129, 0x11};
+    const uint8_t past_data[]     = {0, 10, 1, 2};
+    const uint8_t unknown_block[] = {OLED_BLOCK_COUNT, 0x80, 0x22};
+    oled_remote_decode(past_block, sizeof(past_block));
+    oled_remote_decode(past_data, sizeof(past_data));
+    oled_remote_decode(unknown_block, sizeof(unknown_block));
+    EXPECT_EQ(memcmp(oled_read_raw(0).current_element, frame, OLED_MATRIX_SIZE), 0);
+}
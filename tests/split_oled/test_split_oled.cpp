@@ -0,0 +1,103 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "oled_remote_codec.hpp"
+
+extern "C" {
+#include "split_simulator.h"
+#include "split_util.h"
+#include "transport.h"
+}
+
+/* Both halves share the OLED driver in the simulator. The master leaves its own framebuffer
+   blank, so the one the slave decodes into holds exactly what reached the slave. */
+class SplitOled : public TestFixture {
+   public:
+    SplitOled() {
+        split_simulator_reset();
+        oled_clear();
+        oled_remote_invalidate();
+        for (uint16_t i = 0; i < sizeof(remote_frame); i++) {
+            remote_frame[i] = i / 40 % 3 ? 0 : i;
+        }
+    }
+
+    bool slave_shows_remote_frame(void) {
+        return memcmp(oled_read_raw(0).current_element, remote_frame, OLED_MATRIX_SIZE) == 0;
+    }
+
+    const split_sim_transaction_stats_t *chunks(void) {
+        return &split_simulator_get_stats()->transactions[PUT_OLED_BUFFER];
+    }
+};
+
+TEST_F(SplitOled, SlaveShowsWhatTheMasterDraws) {
+    TestDriver driver;
+
+    split_simulator_clear_stats();
+    idle_for(SPLIT_OLED_BUFFER_INTERVAL * (OLED_BLOCK_COUNT + 1));
+    EXPECT_TRUE(slave_shows_remote_frame());
+    /* Blank areas are run-length encoded, the frame takes less than one chunk per block */
+    EXPECT_LT(chunks()->count, OLED_BLOCK_COUNT);
+    EXPECT_EQ(chunks()->failures, 0);
+
+    /* Then only the blocks that change are sent */
+    remote_frame[OLED_MATRIX_SIZE - 1] ^= 0xff;
+    split_simulator_clear_stats();
+    idle_for(SPLIT_OLED_BUFFER_INTERVAL * 2);
+    EXPECT_TRUE(slave_shows_remote_frame());
+    EXPECT_EQ(chunks()->count, 1);
+
+    split_simulator_clear_stats();
+    idle_for(FORCED_SYNC_THROTTLE_MS);
+    EXPECT_EQ(chunks()->count, 0);
+}
+
+TEST_F(SplitOled, FailedTransferResendsTheFrame) {
+    TestDriver       driver;
+    split_sim_link_t link = split_simulator_get_link();
+
+    idle_for(SPLIT_OLED_BUFFER_INTERVAL * (OLED_BLOCK_COUNT + 1));
+    ASSERT_TRUE(slave_shows_remote_frame());
+
+    /* One chunk of the change is lost on the way, the master can not tell which blocks made it */
+    for (uint16_t i = 0; i < sizeof(remote_frame); i += 7) {
+        remote_frame[i] ^= 0x3c;
+    }
+    split_simulator_clear_stats();
+    link.bit_error_rate = 0.01f;
+    split_simulator_set_link(&link);
+    for (int i = 0; i < 1000 && chunks()->failures == 0; i++) {
+        run_one_scan_loop();
+    }
+    ASSERT_GT(chunks()->failures, 0);
+    link.bit_error_rate = 0.0f;
+    split_simulator_set_link(&link);
+    EXPECT_FALSE(slave_shows_remote_frame());
+
+    /* The halves stay connected, so only the failed transfer brings the frame across again */
+    idle_for(SPLIT_OLED_BUFFER_INTERVAL * (OLED_BLOCK_COUNT + 1));
+    EXPECT_TRUE(is_transport_connected());
+    EXPECT_TRUE(slave_shows_remote_frame());
+}
+
+TEST_F(SplitOled, ReconnectedSlaveGetsAFullFrame) {
+    TestDriver       driver;
+    split_sim_link_t link = split_simulator_get_link();
+
+    idle_for(SPLIT_OLED_BUFFER_INTERVAL * (OLED_BLOCK_COUNT + 1));
+    ASSERT_TRUE(slave_shows_remote_frame());
+
+    /* The slave restarts with a blank display while the link is down, nothing changed on the master */
+    link.drop_rate = 1.0f;
+    split_simulator_set_link(&link);
+    while (is_transport_connected()) {
+        run_one_scan_loop();
+    }
+    oled_clear();
+    link.drop_rate = 0.0f;
+    split_simulator_set_link(&link);
+    idle_for(SPLIT_CONNECTION_CHECK_TIMEOUT + SPLIT_OLED_BUFFER_INTERVAL * (OLED_BLOCK_COUNT + 1));
+    ASSERT_TRUE(is_transport_connected());
+    EXPECT_TRUE(slave_shows_remote_frame());
+}
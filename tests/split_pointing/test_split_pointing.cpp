@@ -0,0 +1,145 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "pointing_device.h"
+#include "split_simulator.h"
+#include "split_util.h"
+}
+
+using testing::_;
+using testing::AnyNumber;
+using testing::Invoke;
+
+static int16_t  sensor_x;
+static int16_t  sensor_y;
+static int32_t  sensor_total_x;
+static int32_t  sensor_total_y;
+static uint16_t sensor_write_cpi;
+
+/* The sensor sits on the right half, which is the slave in the simulator */
+extern "C" report_mouse_t pointing_device_driver_get_report(report_mouse_t mouse_report) {
+    if (!is_keyboard_master()) {
+        /* Stands in for a transaction that lands while the sensor is being read */
+        if (sensor_write_cpi) {
+            split_shmem->pointing.cpi            = sensor_write_cpi;
+            split_shmem->pointing.report.session = 2;
+            sensor_write_cpi                     = 0;
+        }
+        mouse_report.x = sensor_x;
+        mouse_report.y = sensor_y;
+        sensor_total_x += sensor_x;
+        sensor_total_y += sensor_y;
+    }
+    return mouse_report;
+}
+
+class SplitPointing : public TestFixture {
+   public:
+    SplitPointing() {
+        split_simulator_reset();
+        sensor_x = sensor_y = 0;
+        sensor_write_cpi    = 0;
+    }
+
+    /* Adds up the motion of every mouse report sent */
+    void expect_mouse_reports(TestDriver& driver, int32_t& total_x, int32_t& total_y, int16_t& largest) {
+        /* Let the master take its reference reading */
+        idle_for(10);
+        sensor_total_x = sensor_total_y = 0;
+
+        EXPECT_CALL(driver, send_mouse_mock(_)).Times(AnyNumber()).WillRepeatedly(Invoke([&](report_mouse_t& report) {
+            total_x += report.x;
+            total_y += report.y;
+            largest = std::max<int16_t>(largest, std::abs(report.x));
+        }));
+    }
+};
+
+TEST_F(SplitPointing, SlaveMotionArrivesComplete) {
+    TestDriver driver;
+    int32_t    total_x = 0, total_y = 0;
+    int16_t    largest = 0;
+
+    expect_mouse_reports(driver, total_x, total_y, largest);
+    sensor_x = 5;
+    sensor_y = -3;
+    idle_for(100);
+    sensor_x = sensor_y = 0;
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_GT(sensor_total_x, 0);
+    EXPECT_EQ(total_x, sensor_total_x);
+    EXPECT_EQ(total_y, sensor_total_y);
+}
+
+TEST_F(SplitPointing, MotionIsKeptAcrossFailedTransfers) {
+    TestDriver       driver;
+    int32_t          total_x = 0, total_y = 0;
+    int16_t          largest = 0;
+    split_sim_link_t link    = split_simulator_get_link();
+
+    expect_mouse_reports(driver, total_x, total_y, largest);
+    link.drop_rate = 0.05f;
+    split_simulator_set_link(&link);
+    sensor_x = 7;
+    sensor_y = 2;
+    idle_for(200);
+    sensor_x = sensor_y = 0;
+    link.drop_rate      = 0.0f;
+    split_simulator_set_link(&link);
+    /* Long enough to reconnect, should the errors have dropped the connection */
+    idle_for(SPLIT_CONNECTION_CHECK_TIMEOUT + 10);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_GT(split_simulator_get_stats()->dropped_bytes, 0);
+    EXPECT_TRUE(is_transport_connected());
+    EXPECT_EQ(total_x, sensor_total_x);
+    EXPECT_EQ(total_y, sensor_total_y);
+}
+
+TEST_F(SplitPointing, LargeMotionCarriesOverIntoFollowingReports) {
+    TestDriver       driver;
+    int32_t          total_x = 0, total_y = 0;
+    int16_t          largest = 0;
+    split_sim_link_t link    = split_simulator_get_link();
+
+    expect_mouse_reports(driver, total_x, total_y, largest);
+    /* Keep the master from reading for a while, without losing the connection */
+    link.drop_rate = 1.0f;
+    split_simulator_set_link(&link);
+    sensor_x = 100;
+    idle_for(5);
+    sensor_x       = 0;
+    link.drop_rate = 0.0f;
+    split_simulator_set_link(&link);
+    idle_for(20);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(sensor_total_x, 500);
+    EXPECT_EQ(total_x, sensor_total_x);
+    EXPECT_LE(largest, XY_REPORT_MAX);
+}
+
+TEST_F(SplitPointing, WritesDuringASensorReadAreKept) {
+    TestDriver driver;
+    int32_t    total_x = 0, total_y = 0;
+    int16_t    largest = 0;
+
+    expect_mouse_reports(driver, total_x, total_y, largest);
+    sensor_x         = 3;
+    sensor_write_cpi = 1600;
+    idle_for(10);
+    sensor_x = 0;
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+
+    /* The slave only writes back its motion */
+    EXPECT_EQ(sensor_write_cpi, 0);
+    EXPECT_EQ(split_simulator_get_slave_shmem()->pointing.cpi, 1600);
+    EXPECT_EQ(split_simulator_get_slave_shmem()->pointing.report.session, 2);
+    EXPECT_EQ(total_x, sensor_total_x);
+}
@@ -0,0 +1,137 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "serial.h"
+#include "split_simulator.h"
+#include "split_util.h"
+}
+
+using testing::_;
+
+class SplitSerialCrc : public TestFixture {
+   public:
+    SplitSerialCrc() {
+        split_simulator_reset();
+        /* The protocol keeps counting across tests */
+        master_start = *serial_protocol_get_stats();
+        slave_start  = *split_simulator_get_slave_protocol_stats();
+    }
+
+    serial_protocol_stats_t master_start;
+    serial_protocol_stats_t slave_start;
+
+    uint32_t master(uint32_t serial_protocol_stats_t::*field) {
+        return serial_protocol_get_stats()->*field - master_start.*field;
+    }
+
+    uint32_t slave(uint32_t serial_protocol_stats_t::*field) {
+        return split_simulator_get_slave_protocol_stats()->*field - slave_start.*field;
+    }
+
+    void set_link(float bit_error_rate, float drop_rate) {
+        split_sim_link_t link = split_simulator_get_link();
+        link.bit_error_rate   = bit_error_rate;
+        link.drop_rate        = drop_rate;
+        split_simulator_set_link(&link);
+    }
+};
+
+TEST_F(SplitSerialCrc, CleanLinkNeedsNoRetransmits) {
+    TestDriver driver;
+    auto       key_right = KeymapKey(0, 0, 2, KC_B);
+
+    set_keymap({key_right});
+
+    EXPECT_REPORT(driver, (key_right.report_code));
+    key_right.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_right.release();
+    idle_for(FORCED_SYNC_THROTTLE_MS);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_GT(master(&serial_protocol_stats_t::frames), 0);
+    EXPECT_EQ(master(&serial_protocol_stats_t::frames), slave(&serial_protocol_stats_t::frames));
+    EXPECT_EQ(master(&serial_protocol_stats_t::retransmits), 0);
+    EXPECT_EQ(master(&serial_protocol_stats_t::failures), 0);
+    EXPECT_EQ(slave(&serial_protocol_stats_t::header_errors), 0);
+    EXPECT_EQ(slave(&serial_protocol_stats_t::crc_errors), 0);
+}
+
+TEST_F(SplitSerialCrc, CorruptedFramesAreRepeated) {
+    TestDriver driver;
+
+    set_link(0.0005f, 0.0f);
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(5000);
+    VERIFY_AND_CLEAR(driver);
+
+    /* Both halves catch corruption, the master repeats the frame and the transaction still succeeds */
+    EXPECT_GT(split_simulator_get_stats()->corrupted_bytes, 0);
+    EXPECT_GT(slave(&serial_protocol_stats_t::header_errors) + slave(&serial_protocol_stats_t::crc_errors), 0);
+    EXPECT_GT(master(&serial_protocol_stats_t::crc_errors), 0);
+    EXPECT_GT(master(&serial_protocol_stats_t::retransmits), 0);
+    EXPECT_LT(master(&serial_protocol_stats_t::failures), master(&serial_protocol_stats_t::retransmits));
+    EXPECT_TRUE(is_transport_connected());
+}
+
+TEST_F(SplitSerialCrc, LostRepliesAreAnsweredAgain) {
+    TestDriver driver;
+
+    set_link(0.0f, 0.002f);
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(5000);
+    VERIFY_AND_CLEAR(driver);
+
+    /* The slave recognises repeated frames it already executed and only sends the reply again */
+    EXPECT_GT(split_simulator_get_stats()->dropped_bytes, 0);
+    EXPECT_GT(slave(&serial_protocol_stats_t::retransmits), 0);
+    EXPECT_GT(master(&serial_protocol_stats_t::receive_errors), 0);
+    EXPECT_TRUE(is_transport_connected());
+}
+
+TEST_F(SplitSerialCrc, MissingSlaveIsNotRetried) {
+    TestDriver driver;
+    auto       key_right = KeymapKey(0, 0, 2, KC_B);
+
+    set_keymap({key_right});
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(10);
+    set_link(0.0f, 1.0f);
+
+    /* Only the first frame after the link went down is repeated, split_common retries the rest */
+    const split_sim_transaction_stats_t* checksum = &split_simulator_get_stats()->transactions[GET_SLAVE_MATRIX_CHECKSUM];
+    split_simulator_clear_stats();
+    run_one_scan_loop();
+    EXPECT_EQ(checksum->failures, checksum->count);
+    EXPECT_EQ(checksum->bytes_to_slave, 3 * (checksum->count + SERIAL_PROTOCOL_RETRIES));
+
+    /* After that every frame times out once */
+    split_simulator_clear_stats();
+    run_one_scan_loop();
+    EXPECT_EQ(checksum->failures, checksum->count);
+    EXPECT_EQ(checksum->bytes_to_slave, 3 * checksum->count);
+    VERIFY_AND_CLEAR(driver);
+
+    set_link(0.0f, 0.0f);
+
+    EXPECT_REPORT(driver, (key_right.report_code));
+    key_right.press();
+    idle_for(SPLIT_CONNECTION_CHECK_TIMEOUT + 1);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_TRUE(is_transport_connected());
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_right.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
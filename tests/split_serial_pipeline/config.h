@@ -0,0 +1,14 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define FORCED_SYNC_THROTTLE_MS 100
+#define SPLIT_CONNECTION_CHECK_TIMEOUT 500
+#define SPLIT_LAYER_STATE_ENABLE
+#define SERIAL_USART_FULL_DUPLEX
+#define SERIAL_USART_PIPELINE
+#define SERIAL_USART_PIPELINE_BYTES 64
+#define SPLIT_TRANSACTION_STATS_ENABLE
@@ -0,0 +1,77 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "serial.h"
+#include "split_simulator.h"
+#include "split_util.h"
+#include "transport.h"
+}
+
+using testing::_;
+
+class SplitSerialPipeline : public TestFixture {
+   public:
+    SplitSerialPipeline() {
+        split_simulator_reset();
+    }
+
+    void set_drop_rate(float drop_rate) {
+        split_sim_link_t link = split_simulator_get_link();
+        link.drop_rate        = drop_rate;
+        split_simulator_set_link(&link);
+    }
+};
+
+TEST_F(SplitSerialPipeline, CleanLinkConfirmsEveryTransaction) {
+    TestDriver driver;
+    auto       key_right = KeymapKey(0, 0, 2, KC_B);
+
+    set_keymap({key_right});
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(FORCED_SYNC_THROTTLE_MS * 2);
+    VERIFY_AND_CLEAR(driver);
+
+    const split_sim_stats_t* stats = split_simulator_get_stats();
+    EXPECT_GT(stats->transactions[PUT_LAYER_STATE].count, 0);
+    for (uint8_t i = 0; i < NUM_TOTAL_TRANSACTIONS; i++) {
+        EXPECT_EQ(stats->transactions[i].failures, 0) << "transaction " << (int)i;
+    }
+
+    EXPECT_REPORT(driver, (key_right.report_code));
+    key_right.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_right.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SplitSerialPipeline, LostWriteIsSentAgain) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+
+    /* The write is reported as done before its handshake is seen */
+    split_shmem->layers.layer_state = 0x2;
+    set_drop_rate(1.0f);
+    EXPECT_TRUE(soft_serial_transaction(PUT_LAYER_STATE));
+    set_drop_rate(0.0f);
+    EXPECT_NE(split_simulator_get_slave_shmem()->layers.layer_state, 0x2);
+
+    /* The next transaction finds the handshake missing */
+    EXPECT_FALSE(soft_serial_transaction(GET_SLAVE_MATRIX_CHECKSUM));
+
+    /* and the write goes out again ahead of the one after */
+    split_shmem->layers.layer_state = 0x6;
+    EXPECT_TRUE(soft_serial_transaction(GET_SLAVE_MATRIX_CHECKSUM));
+    EXPECT_EQ(split_simulator_get_slave_shmem()->layers.layer_state, 0x6);
+}
@@ -0,0 +1,111 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "serial.h"
+#include "split_simulator.h"
+#include "split_util.h"
+}
+
+using testing::_;
+
+class SplitSerialSpeed : public TestFixture {
+   public:
+    SplitSerialSpeed() {
+        split_simulator_reset();
+    }
+};
+
+TEST_F(SplitSerialSpeed, CleanLinkRunsAtTheMaximumSpeed) {
+    TestDriver driver;
+    auto       key_right = KeymapKey(0, 0, 2, KC_B);
+
+    set_keymap({key_right});
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(100);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(serial_protocol_get_stats()->speed, SERIAL_USART_SPEED_MAX);
+    EXPECT_EQ(split_simulator_get_slave_protocol_stats()->speed, SERIAL_USART_SPEED_MAX);
+    EXPECT_TRUE(is_transport_connected());
+
+    EXPECT_REPORT(driver, (key_right.report_code));
+    key_right.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_right.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SplitSerialSpeed, DegradedLinkFallsBackToASlowerSpeed) {
+    TestDriver       driver;
+    auto             key_right = KeymapKey(0, 0, 2, KC_B);
+    split_sim_link_t link      = split_simulator_get_link();
+
+    set_keymap({key_right});
+
+    /* Up to speed on a clean link first */
+    idle_for(100);
+    ASSERT_EQ(serial_protocol_get_stats()->speed, SERIAL_USART_SPEED_MAX);
+
+    /* Half the maximum speed still gets through */
+    link.max_bit_rate = (uint64_t)link.bit_rate * (SERIAL_USART_SPEED_MAX / 2) / SERIAL_USART_SPEED;
+    split_simulator_set_link(&link);
+    uint32_t fallbacks = serial_protocol_get_stats()->speed_fallbacks;
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(SPLIT_CONNECTION_CHECK_TIMEOUT * 2);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_GT(serial_protocol_get_stats()->speed_fallbacks, fallbacks);
+    EXPECT_EQ(serial_protocol_get_stats()->speed, SERIAL_USART_SPEED_MAX / 2);
+    EXPECT_EQ(split_simulator_get_slave_protocol_stats()->speed, SERIAL_USART_SPEED_MAX / 2);
+    EXPECT_TRUE(is_transport_connected());
+
+    EXPECT_REPORT(driver, (key_right.report_code));
+    key_right.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_right.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SplitSerialSpeed, SlowLinkNegotiatesASlowerSpeed) {
+    TestDriver       driver;
+    auto             key_right = KeymapKey(0, 0, 2, KC_B);
+    split_sim_link_t link      = split_simulator_get_link();
+
+    set_keymap({key_right});
+
+    /* Too slow for the maximum speed from the start, its probes fail and the next one is tried */
+    link.max_bit_rate = (uint64_t)link.bit_rate * (SERIAL_USART_SPEED_MAX / 2) / SERIAL_USART_SPEED;
+    split_simulator_set_link(&link);
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(SPLIT_CONNECTION_CHECK_TIMEOUT);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(serial_protocol_get_stats()->speed, SERIAL_USART_SPEED_MAX / 2);
+    EXPECT_EQ(split_simulator_get_slave_protocol_stats()->speed, SERIAL_USART_SPEED_MAX / 2);
+    EXPECT_TRUE(is_transport_connected());
+
+    EXPECT_REPORT(driver, (key_right.report_code));
+    key_right.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_right.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,100 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "split_simulator.h"
+#include "transactions.h"
+}
+
+using testing::_;
+
+class SplitSyncBudget : public TestFixture {
+   public:
+    SplitSyncBudget() {
+        split_simulator_reset();
+        split_transaction_stats_reset();
+    }
+
+    /* Lets the scheduler settle on a link of the given speed, then starts counting from zero */
+    void settle(TestDriver& driver, uint32_t bit_rate) {
+        EXPECT_NO_REPORT(driver);
+        /* The simulator starts from its default link on the first scan */
+        run_one_scan_loop();
+        split_sim_link_t link = split_simulator_get_link();
+        link.bit_rate         = bit_rate;
+        split_simulator_set_link(&link);
+        idle_for(FORCED_SYNC_THROTTLE_MS * 8);
+        VERIFY_AND_CLEAR(driver);
+        split_simulator_clear_stats();
+        split_transaction_stats_reset();
+    }
+};
+
+TEST_F(SplitSyncBudget, StatisticsFollowTheLink) {
+    TestDriver driver;
+
+    /* About 1ms per byte */
+    settle(driver, 9600);
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(500);
+    VERIFY_AND_CLEAR(driver);
+
+    const split_sim_transaction_stats_t* link  = &split_simulator_get_stats()->transactions[GET_SLAVE_MATRIX_CHECKSUM];
+    const split_transaction_stats_t*     stats = split_transaction_stats(GET_SLAVE_MATRIX_CHECKSUM);
+    ASSERT_NE(stats, nullptr);
+    EXPECT_EQ(stats->count, link->count);
+    EXPECT_EQ(stats->errors, 0);
+    /* The master only sees whole milliseconds here */
+    EXPECT_NEAR(stats->total_us, link->time_us, 1000);
+    EXPECT_GE(stats->max_us, 2000);
+    EXPECT_GE(split_transaction_loop_us(), 2000);
+    EXPECT_EQ(split_transaction_stats(NUM_TOTAL_TRANSACTIONS), nullptr);
+}
+
+TEST_F(SplitSyncBudget, IdleLinkCompressesLowPrioritySyncs) {
+    TestDriver driver;
+
+    settle(driver, 1000000);
+    EXPECT_LT(split_sync_throttle(), FORCED_SYNC_THROTTLE_MS);
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(FORCED_SYNC_THROTTLE_MS * 10);
+    VERIFY_AND_CLEAR(driver);
+
+    /* Forced resyncs of the activity timestamps run more often than FORCED_SYNC_THROTTLE_MS */
+    EXPECT_GT(split_simulator_get_stats()->transactions[PUT_ACTIVITY].count, 15);
+}
+
+TEST_F(SplitSyncBudget, SaturatedLinkStretchesLowPrioritySyncs) {
+    TestDriver driver;
+    auto       key_right = KeymapKey(0, 0, 2, KC_B);
+
+    set_keymap({key_right});
+
+    settle(driver, 9600);
+    EXPECT_GT(split_sync_throttle(), FORCED_SYNC_THROTTLE_MS);
+
+    /* Slave keys still come through in the loop they are read */
+    EXPECT_REPORT(driver, (key_right.report_code));
+    key_right.press();
+    run_one_scan_loop();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_right.release();
+    run_one_scan_loop();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(FORCED_SYNC_THROTTLE_MS * 10);
+    VERIFY_AND_CLEAR(driver);
+
+    /* The new activity timestamps wait for a stretched throttle period instead of going out right away */
+    EXPECT_LE(split_simulator_get_stats()->transactions[PUT_ACTIVITY].count, 3);
+}
@@ -0,0 +1,14 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# --------------------------------------------------------------------------------
+# Keep this file, even if it is empty, as a marker that this folder contains tests
+# --------------------------------------------------------------------------------
+
+SPLIT_KEYBOARD = yes
+RGB_MATRIX_ENABLE = yes
+RGB_MATRIX_DRIVER = custom
+
+# Both halves share the rgb_matrix state in the simulator, it plays the slave and the test
+# supplies what the master sends
+LDFLAGS += -Wl,--wrap=rgb_matrix_get_split_seed -Wl,--wrap=rgb_matrix_get_split_hits
@@ -0,0 +1,209 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "split_simulator.h"
+#include "split_util.h"
+#include "sync_timer.h"
+#include "transport.h"
+}
+
+/* The simulated halves share one rgb_matrix instance, which plays the slave. The master side of
+   the transport reads the seed and hits below instead. */
+static uint16_t          master_seed;
+static rgb_matrix_hits_t master_hits;
+
+extern "C" {
+uint16_t __real_rgb_matrix_get_split_seed(void);
+void     __real_rgb_matrix_get_split_hits(rgb_matrix_hits_t *hits);
+
+uint16_t __wrap_rgb_matrix_get_split_seed(void) {
+    return master_seed;
+}
+
+void __wrap_rgb_matrix_get_split_hits(rgb_matrix_hits_t *hits) {
+    *hits = master_hits;
+}
+
+led_config_t g_led_config;
+
+static void init(void) {}
+static void set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {}
+static void set_color_all(uint8_t red, uint8_t green, uint8_t blue) {}
+static void flush(void) {}
+
+const rgb_matrix_driver_t rgb_matrix_driver = {
+    .init          = init,
+    .set_color     = set_color,
+    .set_color_all = set_color_all,
+    .flush         = flush,
+};
+}
+
+class RgbMatrixLockstep : public TestFixture {
+   public:
+    RgbMatrixLockstep() {
+        /* Two keys on each half */
+        memset(&g_led_config, 0, sizeof(g_led_config));
+        memset(g_led_config.matrix_co, NO_LED, sizeof(g_led_config.matrix_co));
+        g_led_config.matrix_co[0][0] = 0;
+        g_led_config.matrix_co[0][1] = 1;
+        g_led_config.matrix_co[2][0] = 2;
+        g_led_config.matrix_co[2][1] = 3;
+        for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+            g_led_config.point[i] = {(uint8_t)(i * 64), 0};
+            g_led_config.flags[i] = LED_FLAG_KEYLIGHT;
+        }
+        split_simulator_reset();
+        /* The test clock restarts with every test, hits kept from the last one would look recent */
+        rgb_matrix_init();
+    }
+
+    /* Same as rgb_matrix_handle_key_event() on the master */
+    void master_hit(uint8_t row, uint8_t col) {
+        memmove(&master_hits.hits[0], &master_hits.hits[1], sizeof(rgb_matrix_hit_t) * (RGB_MATRIX_SPLIT_HITS - 1));
+        master_hits.hits[RGB_MATRIX_SPLIT_HITS - 1] = {row, col, true, (uint16_t)sync_timer_read32()};
+        master_hits.count++;
+    }
+
+    /* Drops the link until the master notices, so the next connection starts a new session */
+    void new_session(void) {
+        split_sim_link_t link = split_simulator_get_link();
+        link.drop_rate        = 1.0f;
+        split_simulator_set_link(&link);
+        while (is_transport_connected()) {
+            run_one_scan_loop();
+        }
+        link.drop_rate = 0.0f;
+        split_simulator_set_link(&link);
+        idle_for(SPLIT_CONNECTION_CHECK_TIMEOUT + 1);
+        ASSERT_TRUE(is_transport_connected());
+    }
+
+    /* Hits the slave rendered in its last frame that were stamped at or after `since` */
+    uint8_t hits_since(uint32_t since) {
+        uint8_t count = 0;
+        for (uint8_t i = 0; i < g_last_hit_tracker.count; i++) {
+            if (g_rgb_timer - g_last_hit_tracker.tick[i] >= since) {
+                count++;
+            }
+        }
+        return count;
+    }
+
+    uint8_t slave_session(void) {
+        rgb_matrix_hits_t hits;
+        __real_rgb_matrix_get_split_hits(&hits);
+        return hits.session;
+    }
+
+    uint8_t slave_count(void) {
+        rgb_matrix_hits_t hits;
+        __real_rgb_matrix_get_split_hits(&hits);
+        return hits.count;
+    }
+};
+
+TEST_F(RgbMatrixLockstep, SeedReachesTheSlave) {
+    TestDriver driver;
+
+    idle_for(10);
+    /* The slave picks the seed up on its next loop */
+    master_seed = 0x1234;
+    run_one_scan_loop();
+    run_one_scan_loop();
+    EXPECT_EQ(__real_rgb_matrix_get_split_seed(), 0x1234);
+
+    master_seed = 0xbeef;
+    run_one_scan_loop();
+    run_one_scan_loop();
+    EXPECT_EQ(__real_rgb_matrix_get_split_seed(), 0xbeef);
+}
+
+TEST_F(RgbMatrixLockstep, FirstSyncOfASessionSkipsOldHits) {
+    TestDriver driver;
+
+    new_session();
+    uint32_t start = sync_timer_read32();
+
+    /* The slave missed these, it only adopts the count once the halves reconnect */
+    split_sim_link_t link = split_simulator_get_link();
+    link.drop_rate        = 1.0f;
+    split_simulator_set_link(&link);
+    while (is_transport_connected()) {
+        run_one_scan_loop();
+    }
+    master_hit(0, 0);
+    master_hit(2, 1);
+    link.drop_rate = 0.0f;
+    split_simulator_set_link(&link);
+    idle_for(SPLIT_CONNECTION_CHECK_TIMEOUT + 1);
+    ASSERT_TRUE(is_transport_connected());
+    idle_for(RGB_MATRIX_LED_FLUSH_LIMIT * 2);
+
+    EXPECT_EQ(slave_session(), split_simulator_get_slave_shmem()->rgb_matrix_hits.session);
+    EXPECT_EQ(slave_count(), master_hits.count);
+    EXPECT_EQ(hits_since(start), 0);
+
+    /* The next hit of the session is replayed */
+    start = sync_timer_read32();
+    master_hit(2, 0);
+    idle_for(RGB_MATRIX_LED_FLUSH_LIMIT * 2);
+    ASSERT_EQ(hits_since(start), 1);
+    EXPECT_EQ(g_last_hit_tracker.index[g_last_hit_tracker.count - 1], 2);
+}
+
+TEST_F(RgbMatrixLockstep, HitIsAgedFromItsStamp) {
+    TestDriver driver;
+
+    new_session();
+
+    /* A slow link delivers the hit several milliseconds after it was stamped */
+    split_sim_link_t link = split_simulator_get_link();
+    link.latency_us       = 3000;
+    split_simulator_set_link(&link);
+    idle_for(RGB_MATRIX_LED_FLUSH_LIMIT);
+
+    uint32_t stamp = sync_timer_read32();
+    master_hit(0, 1);
+    idle_for(RGB_MATRIX_LED_FLUSH_LIMIT * 3);
+    ASSERT_EQ(hits_since(stamp), 1);
+    EXPECT_EQ(g_rgb_timer - g_last_hit_tracker.tick[g_last_hit_tracker.count - 1], stamp);
+    EXPECT_EQ(g_last_hit_tracker.index[g_last_hit_tracker.count - 1], 1);
+}
+
+TEST_F(RgbMatrixLockstep, ResentHitsAreNotReplayedAgain) {
+    TestDriver driver;
+
+    new_session();
+    uint32_t start = sync_timer_read32();
+
+    master_hit(0, 0);
+    idle_for(RGB_MATRIX_LED_FLUSH_LIMIT * 2);
+    ASSERT_EQ(hits_since(start), 1);
+
+    /* The forced resync sends the same hits again, the slave already replayed them */
+    split_simulator_clear_stats();
+    idle_for(FORCED_SYNC_THROTTLE_MS * 3);
+    EXPECT_GE(split_simulator_get_stats()->transactions[PUT_RGB_MATRIX_HITS].count, 2);
+    EXPECT_EQ(hits_since(start), 1);
+    EXPECT_EQ(slave_count(), master_hits.count);
+}
+
+TEST_F(RgbMatrixLockstep, BurstIsCappedAtTheHitsSent) {
+    TestDriver driver;
+
+    new_session();
+    uint32_t start = sync_timer_read32();
+
+    /* More hits than fit in one transfer, only the last RGB_MATRIX_SPLIT_HITS are left to replay */
+    for (uint8_t i = 0; i < RGB_MATRIX_SPLIT_HITS + 2; i++) {
+        master_hit(i % 2 ? 2 : 0, i / 2 % 2);
+    }
+    idle_for(RGB_MATRIX_LED_FLUSH_LIMIT * 2);
+    EXPECT_EQ(hits_since(start), RGB_MATRIX_SPLIT_HITS);
+    EXPECT_EQ(slave_count(), master_hits.count);
+}
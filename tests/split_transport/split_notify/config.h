@@ -0,0 +1,27 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define FORCED_SYNC_THROTTLE_MS 100
+#define SPLIT_CONNECTION_CHECK_TIMEOUT 500
+
+#define SPLIT_NOTIFY_PIN 0
+
+/* The test platform has no GPIO, the notify line between the halves is a variable of the test */
+#ifdef __cplusplus
+extern "C" {
+#endif
+#include <stdbool.h>
+extern bool split_notify_line;
+#ifdef __cplusplus
+}
+#endif
+
+#define gpio_set_pin_input_high(pin) (split_notify_line = true)
+#define gpio_set_pin_output(pin) ((void)0)
+#define gpio_write_pin_high(pin) (split_notify_line = true)
+#define gpio_write_pin(pin, level) (split_notify_line = (level))
+#define gpio_read_pin(pin) (split_notify_line)
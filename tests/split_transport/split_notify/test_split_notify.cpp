@@ -0,0 +1,163 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "split_simulator.h"
+#include "split_util.h"
+#include "transport.h"
+#include "crc.h"
+}
+
+using testing::_;
+
+/* High while the slave has nothing to report */
+extern "C" bool split_notify_line = true;
+
+class SplitNotify : public TestFixture {
+   public:
+    SplitNotify() {
+        split_simulator_reset();
+        split_notify_line = true;
+    }
+
+    /* Number of times the master read the slave matrix checksum during `ms` idle milliseconds */
+    uint32_t checksum_polls_while_idle(uint32_t ms) {
+        split_simulator_clear_stats();
+        idle_for(ms);
+        return split_simulator_get_stats()->transactions[GET_SLAVE_MATRIX_CHECKSUM].count;
+    }
+
+    uint32_t acks(void) {
+        return split_simulator_get_stats()->transactions[PUT_NOTIFY_ACK].count;
+    }
+
+    /* The slave data the master acknowledged, as the slave sees it */
+    uint8_t acknowledged_checksum(void) {
+        return split_simulator_get_slave_shmem()->notify_ack.matrix_checksum;
+    }
+
+    uint8_t slave_checksum(void) {
+        return split_simulator_get_slave_shmem()->smatrix.checksum;
+    }
+};
+
+TEST_F(SplitNotify, IdleLineOnlyPollsAtTheKeepalive) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(10);
+    EXPECT_TRUE(split_notify_line);
+    /* One keepalive read per SPLIT_NOTIFY_KEEPALIVE_MS, instead of one per scan */
+    EXPECT_LE(checksum_polls_while_idle(FORCED_SYNC_THROTTLE_MS * 4), 4);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SplitNotify, ChangeIsNotifiedAcknowledgedAndReleased) {
+    TestDriver driver;
+    auto       key_right = KeymapKey(0, 0, 2, KC_B);
+
+    set_keymap({key_right});
+    idle_for(10);
+    ASSERT_TRUE(split_notify_line);
+    split_simulator_clear_stats();
+
+    /* The slave pulls the line low in its loop, the master reads the change in the same scan */
+    EXPECT_REPORT(driver, (key_right.report_code));
+    key_right.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_FALSE(split_notify_line);
+    EXPECT_EQ(split_simulator_get_stats()->transactions[GET_SLAVE_MATRIX_DATA].count, 1);
+
+    /* The master acknowledged what it read, the slave releases the line on its next loop */
+    EXPECT_EQ(acks(), 1);
+    EXPECT_EQ(acknowledged_checksum(), slave_checksum());
+    EXPECT_NO_REPORT(driver);
+    run_one_scan_loop();
+    EXPECT_TRUE(split_notify_line);
+
+    /* And the link goes back to idle */
+    EXPECT_LE(checksum_polls_while_idle(FORCED_SYNC_THROTTLE_MS * 2), 2);
+    /* Only the forced resync of the ack is left */
+    EXPECT_LE(acks(), 2);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_right.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SplitNotify, MismatchedAckKeepsTheLineLow) {
+    TestDriver driver;
+    auto       key_right = KeymapKey(0, 0, 2, KC_B);
+
+    set_keymap({key_right});
+    idle_for(10);
+    split_simulator_clear_stats();
+
+    /* The master is not scanning, so nothing acknowledges the change */
+    key_right.press();
+    split_sim_link_t link = split_simulator_get_link();
+    link.drop_rate        = 1.0f;
+    split_simulator_set_link(&link);
+    EXPECT_NO_REPORT(driver);
+    run_one_scan_loop();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_NE(acknowledged_checksum(), slave_checksum());
+    EXPECT_FALSE(split_notify_line);
+
+    /* Still low on the next loops, until the master reads and acknowledges the new data */
+    link.drop_rate = 0.0f;
+    split_simulator_set_link(&link);
+    EXPECT_REPORT(driver, (key_right.report_code));
+    idle_for(SPLIT_CONNECTION_CHECK_TIMEOUT + 1);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(acknowledged_checksum(), slave_checksum());
+    EXPECT_TRUE(split_notify_line);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_right.release();
+    idle_for(2);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SplitNotify, NoisyLinkNeverLeavesTheMasterStale) {
+    TestDriver       driver;
+    auto             key_right = KeymapKey(0, 0, 2, KC_B);
+    split_sim_link_t link      = split_simulator_get_link();
+
+    set_keymap({key_right});
+    idle_for(10);
+
+    /* A noisy link corrupts some reads. Whenever the slave releases the line, the master must
+       already hold its current matrix, or it would miss the change until the next keepalive. */
+    link.bit_error_rate = 0.002f;
+    split_simulator_set_link(&link);
+    EXPECT_REPORT(driver, (key_right.report_code)).Times(testing::AnyNumber());
+    EXPECT_EMPTY_REPORT(driver).Times(testing::AnyNumber());
+    for (int i = 0; i < 2000; i++) {
+        if (i % 7 == 0) {
+            /* Directly, the master may not have seen the last change yet */
+            if (i % 14 == 0) {
+                press_key(key_right.position.col, key_right.position.row);
+            } else {
+                release_key(key_right.position.col, key_right.position.row);
+            }
+        }
+        run_one_scan_loop();
+        if (split_notify_line) {
+            EXPECT_EQ(crc8(split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix)), slave_checksum()) << "loop " << i;
+        }
+    }
+    link.bit_error_rate = 0.0f;
+    split_simulator_set_link(&link);
+    release_key(key_right.position.col, key_right.position.row);
+    idle_for(FORCED_SYNC_THROTTLE_MS);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_GT(split_simulator_get_stats()->corrupted_bytes, 0);
+}
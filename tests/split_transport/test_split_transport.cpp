@@ -0,0 +1,146 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "split_simulator.h"
+#include "split_util.h"
+#include "timer.h"
+}
+
+using testing::_;
+using testing::InSequence;
+using testing::InvokeWithoutArgs;
+
+class SplitTransport : public TestFixture {
+   public:
+    SplitTransport() {
+        split_simulator_reset();
+    }
+
+    /* Presses the key and returns the time it took until a report was sent */
+    uint32_t press_and_measure(TestDriver& driver, KeymapKey& key, unsigned max_loops = 100) {
+        uint32_t reported_at = 0;
+        bool     reported    = false;
+        EXPECT_REPORT(driver, (key.report_code)).WillOnce(InvokeWithoutArgs([&]() {
+            reported_at = timer_read32();
+            reported    = true;
+        }));
+
+        uint32_t pressed_at = timer_read32();
+        key.press();
+        for (unsigned i = 0; i < max_loops && !reported; i++) {
+            run_one_scan_loop();
+        }
+        VERIFY_AND_CLEAR(driver);
+        EXPECT_TRUE(reported);
+        return reported_at - pressed_at;
+    }
+};
+
+TEST_F(SplitTransport, SlaveKeyIsReportedWithinOneScan) {
+    TestDriver driver;
+    auto       key_left  = KeymapKey(0, 0, 0, KC_A);
+    auto       key_right = KeymapKey(0, 0, 2, KC_B);
+
+    set_keymap({key_left, key_right});
+
+    EXPECT_LE(press_and_measure(driver, key_right), 1);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_right.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SplitTransport, SlowLinkAddsLatency) {
+    TestDriver       driver;
+    auto             key_right = KeymapKey(0, 0, 2, KC_B);
+    split_sim_link_t link      = split_simulator_get_link();
+
+    set_keymap({key_right});
+
+    /* About 1ms per byte */
+    link.bit_rate = 9600;
+    split_simulator_set_link(&link);
+    idle_for(FORCED_SYNC_THROTTLE_MS);
+
+    EXPECT_GE(press_and_measure(driver, key_right), 5);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_right.release();
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SplitTransport, IdleLinkOnlyPollsChecksums) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(10);
+    split_simulator_clear_stats();
+    idle_for(FORCED_SYNC_THROTTLE_MS * 2);
+    VERIFY_AND_CLEAR(driver);
+
+    const split_sim_stats_t* stats = split_simulator_get_stats();
+    EXPECT_EQ(stats->transactions[GET_SLAVE_MATRIX_CHECKSUM].count, FORCED_SYNC_THROTTLE_MS * 2);
+    EXPECT_EQ(stats->transactions[GET_SLAVE_MATRIX_CHECKSUM].failures, 0);
+    /* ID out, handshake and checksum back */
+    EXPECT_EQ(stats->transactions[GET_SLAVE_MATRIX_CHECKSUM].bytes_to_slave, FORCED_SYNC_THROTTLE_MS * 2);
+    EXPECT_EQ(stats->transactions[GET_SLAVE_MATRIX_CHECKSUM].bytes_to_master, FORCED_SYNC_THROTTLE_MS * 4);
+    /* The matrix itself is only read by the forced sync */
+    EXPECT_LE(stats->transactions[GET_SLAVE_MATRIX_DATA].count, 2);
+}
+
+TEST_F(SplitTransport, RecoversAfterLinkLoss) {
+    TestDriver       driver;
+    auto             key_right = KeymapKey(0, 0, 2, KC_B);
+    split_sim_link_t link      = split_simulator_get_link();
+
+    set_keymap({key_right});
+
+    link.drop_rate = 1.0f;
+    split_simulator_set_link(&link);
+
+    EXPECT_NO_REPORT(driver);
+    key_right.press();
+    idle_for(100);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_FALSE(is_transport_connected());
+    EXPECT_GT(split_simulator_get_stats()->dropped_bytes, 0);
+
+    link.drop_rate = 0.0f;
+    split_simulator_set_link(&link);
+
+    EXPECT_REPORT(driver, (key_right.report_code));
+    idle_for(SPLIT_CONNECTION_CHECK_TIMEOUT + 1);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_TRUE(is_transport_connected());
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_right.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SplitTransport, BitErrorsDoNotProduceKeys) {
+    TestDriver       driver;
+    split_sim_link_t link = split_simulator_get_link();
+
+    link.bit_error_rate = 0.001f;
+    split_simulator_set_link(&link);
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(5000);
+    VERIFY_AND_CLEAR(driver);
+
+    const split_sim_stats_t* stats = split_simulator_get_stats();
+    EXPECT_GT(stats->corrupted_bytes, 0);
+    EXPECT_GT(stats->transactions[GET_SLAVE_MATRIX_CHECKSUM].failures + stats->transactions[GET_SLAVE_MATRIX_DATA].failures, 0);
+    EXPECT_TRUE(is_transport_connected());
+
+    link.bit_error_rate = 0.0f;
+    split_simulator_set_link(&link);
+}
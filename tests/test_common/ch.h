@@ -0,0 +1,36 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+/*
+ * Just enough of the ChibiOS kernel to build serial_protocol.c for the split simulator. The slave
+ * protocol thread becomes a host thread, which split_simulator.c only lets run while the master
+ * waits for it.
+ */
+
+#include <stdint.h>
+
+#define likely(x) __builtin_expect(!!(x), 1)
+#define unlikely(x) __builtin_expect(!!(x), 0)
+
+#define HIGHPRIO 0
+
+typedef uint32_t systime_t;
+typedef uint32_t sysinterval_t;
+
+/* System time counts microseconds of simulated link time. */
+#define chVTGetSystemTimeX() split_simulator_now_us()
+#define chTimeDiffX(start, end) ((sysinterval_t)((end) - (start)))
+#define chTimeI2US(interval) (interval)
+
+#define THD_WORKING_AREA(name, size) uint8_t name[size]
+#define THD_FUNCTION(name, arg) void name(void *arg)
+
+#define chRegSetThreadName(name) (void)(name)
+#define chThdCreateStatic(wa, size, prio, func, arg) ((void)(wa), (void)(size), (void)(prio), split_simulator_start_thread(func, arg))
+#define chThdSleepMilliseconds(ms) split_simulator_sleep_ms(ms)
+
+void     split_simulator_start_thread(void (*func)(void *), void *arg);
+void     split_simulator_sleep_ms(uint32_t ms);
+uint32_t split_simulator_now_us(void);
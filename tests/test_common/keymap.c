@@ -21,13 +21,8 @@
 const uint16_t PROGMEM
                keymaps[][MATRIX_ROWS][MATRIX_COLS] =
         {
-            [0] =
-                {
-                   {KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO},
-                   {KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO},
-                   {KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO},
-                   {KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO},
-                },
+            // Every key is KC_NO, whatever matrix size the test configures
+            [0] = {{KC_NO}},
 };
 
 // clang-format on
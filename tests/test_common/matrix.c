@@ -20,18 +20,32 @@
 
 static matrix_row_t matrix[MATRIX_ROWS] = {};
 
+#ifdef SPLIT_KEYBOARD
+#    include "split_simulator.h"
+
+// What the master sees, the right half only arrives through the simulated split link
+static matrix_row_t split_view[MATRIX_ROWS] = {};
+#endif
+
 void matrix_init(void) {
     clear_all_keys();
     matrix_init_kb();
 }
 
 uint8_t matrix_scan(void) {
+#ifdef SPLIT_KEYBOARD
+    split_simulator_scan(matrix, split_view);
+#endif
     matrix_scan_kb();
     return 1;
 }
 
 matrix_row_t matrix_get_row(uint8_t row) {
+#ifdef SPLIT_KEYBOARD
+    return split_view[row];
+#else
     return matrix[row];
+#endif
 }
 
 void matrix_print(void) {}
@@ -0,0 +1,29 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+/*
+ * Each half of the simulated keyboard links its own copy of serial_protocol.c, so that the
+ * protocol state of the two halves stays apart. Included before the protocol source, this renames
+ * its entry points and the serial transport it talks to after SPLIT_SIM_HALF, e.g.
+ * `soft_serial_transaction` becomes `split_sim_master_transaction`. split_simulator.c provides the
+ * transport of both halves and calls into them.
+ */
+
+#define SPLIT_SIM_NAME(name) SPLIT_SIM_NAME_(SPLIT_SIM_HALF, name)
+#define SPLIT_SIM_NAME_(half, name) SPLIT_SIM_NAME__(half, name)
+#define SPLIT_SIM_NAME__(half, name) split_sim_##half##_##name
+
+#define soft_serial_initiator_init SPLIT_SIM_NAME(initiator_init)
+#define soft_serial_target_init SPLIT_SIM_NAME(target_init)
+#define soft_serial_transaction SPLIT_SIM_NAME(transaction)
+#define serial_protocol_get_stats SPLIT_SIM_NAME(get_stats)
+
+#define serial_transport_driver_clear SPLIT_SIM_NAME(driver_clear)
+#define serial_transport_driver_slave_init SPLIT_SIM_NAME(driver_slave_init)
+#define serial_transport_driver_master_init SPLIT_SIM_NAME(driver_master_init)
+#define serial_transport_driver_set_speed SPLIT_SIM_NAME(driver_set_speed)
+#define serial_transport_receive SPLIT_SIM_NAME(receive)
+#define serial_transport_receive_blocking SPLIT_SIM_NAME(receive_blocking)
+#define serial_transport_send SPLIT_SIM_NAME(send)
@@ -0,0 +1,7 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// The slave half of the serial protocol, linked against the simulated link of split_simulator.c
+#define SPLIT_SIM_HALF slave
+#include "split_serial_half.h"
+#include "serial_protocol.c"
@@ -0,0 +1,456 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <pthread.h>
+#include <string.h>
+#include "split_simulator.h"
+#include "serial.h"
+#include "serial_usart.h"
+#include "split_util.h"
+#include "timer.h"
+#include "transactions.h"
+#include "transport.h"
+
+#define ROWS_PER_HAND (MATRIX_ROWS / 2)
+#define LINK_QUEUE_SIZE 512
+
+void advance_time(uint32_t ms);
+
+// The protocol copies of both halves, see split_serial_half.h
+void split_sim_master_initiator_init(void);
+bool split_sim_master_transaction(int index);
+void split_sim_slave_target_init(void);
+#if defined(SERIAL_PROTOCOL_CRC)
+const serial_protocol_stats_t *split_sim_master_get_stats(void);
+const serial_protocol_stats_t *split_sim_slave_get_stats(void);
+#endif
+
+typedef enum {
+    SIDE_MASTER,
+    SIDE_SLAVE,
+} link_side_t;
+
+// Receive queue of one half
+typedef struct link_queue_t {
+    uint8_t  data[LINK_QUEUE_SIZE];
+    uint16_t head;
+    uint16_t count;
+} link_queue_t;
+
+static const split_sim_link_t default_link = {
+    .bit_rate   = 1000000,
+    .timeout_us = 20000,
+    .seed       = 1,
+};
+
+static split_sim_link_t               link;
+static split_sim_stats_t              stats;
+static split_sim_transaction_stats_t *current_stats;
+static split_sim_transaction_stats_t  untracked_stats;
+static uint32_t                       link_rng;
+static uint32_t                       pending_us;
+static link_queue_t                   queues[2];
+static uint32_t                       speeds[2] = {SERIAL_USART_SPEED, SERIAL_USART_SPEED};
+static int8_t                         last_sender = -1;
+static bool                           in_slave;
+static bool                           last_connected;
+static split_shared_memory_t          slave_shmem;
+static split_shared_memory_t          master_shmem;
+static matrix_row_t                   slave_view[MATRIX_ROWS];
+static bool                           initialized;
+
+// The slave protocol thread, it only runs while the master thread waits for it
+static pthread_t       slave_thread;
+static pthread_mutex_t slave_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  slave_cond  = PTHREAD_COND_INITIALIZER;
+static void (*slave_func)(void *);
+static void    *slave_arg;
+static bool     slave_started;
+static bool     slave_running;
+static size_t   slave_need = 1;   // bytes the slave waits for
+static bool     slave_timed;      // the slave waits with a timeout, rather than for the next frame
+static bool     slave_expired;    // the timeout passed, the slave gives up once it runs again
+static uint32_t slave_wait_start; // link time the slave started waiting at
+
+////////////////////////////////////////////////////
+// Roles
+
+// Both halves share the process, the role follows whichever side is currently running
+bool is_keyboard_master(void) {
+    return !in_slave;
+}
+
+bool is_keyboard_left(void) {
+    return !in_slave;
+}
+
+// Swaps in the slave copy of the shared memory, split_common code then runs as the slave
+static void enter_slave(void) {
+    memcpy(&master_shmem, split_shmem, sizeof(split_shared_memory_t));
+    memcpy(split_shmem, &slave_shmem, sizeof(split_shared_memory_t));
+    in_slave = true;
+}
+
+static void leave_slave(void) {
+    memcpy(&slave_shmem, split_shmem, sizeof(split_shared_memory_t));
+    memcpy(split_shmem, &master_shmem, sizeof(split_shared_memory_t));
+    in_slave = false;
+}
+
+////////////////////////////////////////////////////
+// Slave thread
+
+static void *slave_thread_main(void *arg) {
+    (void)arg;
+    pthread_mutex_lock(&slave_mutex);
+    while (!slave_running) {
+        pthread_cond_wait(&slave_cond, &slave_mutex);
+    }
+    pthread_mutex_unlock(&slave_mutex);
+
+    slave_func(slave_arg);
+    return NULL;
+}
+
+void split_simulator_start_thread(void (*func)(void *), void *arg) {
+    if (slave_started) {
+        return;
+    }
+    slave_func    = func;
+    slave_arg     = arg;
+    slave_started = true;
+    pthread_create(&slave_thread, NULL, slave_thread_main, NULL);
+}
+
+static bool slave_can_run(void) {
+    return slave_started && (slave_expired || queues[SIDE_SLAVE].count >= slave_need);
+}
+
+// Called by the master, returns once the slave waits for more bytes again
+static void run_slave(void) {
+    enter_slave();
+    pthread_mutex_lock(&slave_mutex);
+    slave_running = true;
+    pthread_cond_broadcast(&slave_cond);
+    while (slave_running) {
+        pthread_cond_wait(&slave_cond, &slave_mutex);
+    }
+    pthread_mutex_unlock(&slave_mutex);
+    leave_slave();
+}
+
+// Called by the slave, returns once the master lets it run again
+static void slave_yield(void) {
+    pthread_mutex_lock(&slave_mutex);
+    slave_running = false;
+    pthread_cond_broadcast(&slave_cond);
+    while (!slave_running) {
+        pthread_cond_wait(&slave_cond, &slave_mutex);
+    }
+    pthread_mutex_unlock(&slave_mutex);
+}
+
+////////////////////////////////////////////////////
+// Link model
+
+static float link_random(void) {
+    // xorshift32
+    link_rng ^= link_rng << 13;
+    link_rng ^= link_rng >> 17;
+    link_rng ^= link_rng << 5;
+    return (float)(link_rng >> 8) / (float)(1UL << 24);
+}
+
+static uint32_t link_now_us(void) {
+    return timer_read32() * 1000UL + pending_us;
+}
+
+static void link_spend(uint32_t us) {
+    split_sim_transaction_stats_t *trans_stats = current_stats ? current_stats : &untracked_stats;
+    trans_stats->time_us += us;
+    stats.link_time_us += us;
+    pending_us += us;
+}
+
+static void link_flush_time(void) {
+    advance_time(pending_us / 1000);
+    pending_us %= 1000;
+}
+
+static void queue_clear(link_side_t side) {
+    queues[side].head  = 0;
+    queues[side].count = 0;
+}
+
+static void queue_pop(link_side_t side, uint8_t *dst, size_t size) {
+    link_queue_t *queue = &queues[side];
+    for (size_t i = 0; i < size; i++) {
+        dst[i]      = queue->data[queue->head];
+        queue->head = (queue->head + 1) % LINK_QUEUE_SIZE;
+        queue->count--;
+    }
+}
+
+/**
+ * @brief Puts bytes on the wire, applying the configured errors. Bytes are garbled while the
+ * halves run at different speeds, or faster than the link carries.
+ */
+static void link_send(link_side_t from, const uint8_t *src, size_t size) {
+    split_sim_transaction_stats_t *trans_stats = current_stats ? current_stats : &untracked_stats;
+    link_side_t                    to          = from == SIDE_MASTER ? SIDE_SLAVE : SIDE_MASTER;
+    link_queue_t                  *queue       = &queues[to];
+    uint32_t                       bit_rate    = (uint64_t)link.bit_rate * speeds[from] / SERIAL_USART_SPEED;
+    bool                           garbled     = speeds[from] != speeds[to] || (link.max_bit_rate && bit_rate > link.max_bit_rate);
+
+    if (last_sender != from) {
+        link_spend(link.latency_us);
+        last_sender = from;
+    }
+
+    for (size_t i = 0; i < size; i++) {
+        link_spend(10UL * 1000000UL / bit_rate);
+        if (from == SIDE_MASTER) {
+            trans_stats->bytes_to_slave++;
+        } else {
+            trans_stats->bytes_to_master++;
+        }
+
+        if ((link.drop_rate > 0 && link_random() < link.drop_rate) || queue->count == LINK_QUEUE_SIZE) {
+            stats.dropped_bytes++;
+            continue;
+        }
+
+        uint8_t byte = src[i];
+        if (garbled) {
+            byte = (uint8_t)(link_random() * 256);
+        } else if (link.bit_error_rate > 0) {
+            for (uint8_t bit = 0; bit < 8; bit++) {
+                if (link_random() < link.bit_error_rate) {
+                    byte ^= 1 << bit;
+                }
+            }
+        }
+        if (byte != src[i]) {
+            stats.corrupted_bytes++;
+        }
+
+        queue->data[(queue->head + queue->count) % LINK_QUEUE_SIZE] = byte;
+        queue->count++;
+    }
+}
+
+static bool master_receive(uint8_t *dst, size_t size) {
+    while (queues[SIDE_MASTER].count < size) {
+        if (!slave_can_run()) {
+            // Nothing else is coming, both halves give up after the timeout
+            slave_expired = slave_timed;
+            link_spend(link.timeout_us);
+            return false;
+        }
+        run_slave();
+    }
+    queue_pop(SIDE_MASTER, dst, size);
+    return true;
+}
+
+static bool master_send(const uint8_t *src, size_t size) {
+    // A slave that waited longer than its timeout gave up before these bytes arrive
+    if (slave_timed && link_now_us() - slave_wait_start >= link.timeout_us) {
+        slave_expired = true;
+    }
+    while (slave_expired) {
+        run_slave();
+    }
+    link_send(SIDE_MASTER, src, size);
+    return true;
+}
+
+static bool slave_receive(uint8_t *dst, size_t size, bool timed) {
+    slave_wait_start = link_now_us();
+    while (queues[SIDE_SLAVE].count < size) {
+        slave_need  = size;
+        slave_timed = timed;
+        slave_yield();
+        if (slave_expired) {
+            slave_expired = false;
+            slave_timed   = false;
+            return false;
+        }
+    }
+    slave_timed = false;
+    queue_pop(SIDE_SLAVE, dst, size);
+    return true;
+}
+
+static bool slave_send(const uint8_t *src, size_t size) {
+    link_send(SIDE_SLAVE, src, size);
+    return true;
+}
+
+void split_simulator_sleep_ms(uint32_t ms) {
+    pending_us += ms * 1000;
+}
+
+uint32_t split_simulator_now_us(void) {
+    return link_now_us();
+}
+
+////////////////////////////////////////////////////
+// Serial transport of both halves
+
+void split_sim_master_driver_clear(void) {
+    queue_clear(SIDE_MASTER);
+}
+
+void split_sim_master_driver_slave_init(void) {}
+
+void split_sim_master_driver_master_init(void) {}
+
+void split_sim_master_driver_set_speed(uint32_t speed) {
+    speeds[SIDE_MASTER] = speed;
+}
+
+bool split_sim_master_receive(uint8_t *destination, const size_t size) {
+    return master_receive(destination, size);
+}
+
+bool split_sim_master_receive_blocking(uint8_t *destination, const size_t size) {
+    return master_receive(destination, size);
+}
+
+bool split_sim_master_send(const uint8_t *source, const size_t size) {
+    return master_send(source, size);
+}
+
+void split_sim_slave_driver_clear(void) {
+    queue_clear(SIDE_SLAVE);
+}
+
+void split_sim_slave_driver_slave_init(void) {}
+
+void split_sim_slave_driver_master_init(void) {}
+
+void split_sim_slave_driver_set_speed(uint32_t speed) {
+    speeds[SIDE_SLAVE] = speed;
+}
+
+bool split_sim_slave_receive(uint8_t *destination, const size_t size) {
+    return slave_receive(destination, size, true);
+}
+
+bool split_sim_slave_receive_blocking(uint8_t *destination, const size_t size) {
+    return slave_receive(destination, size, false);
+}
+
+bool split_sim_slave_send(const uint8_t *source, const size_t size) {
+    return slave_send(source, size);
+}
+
+////////////////////////////////////////////////////
+// Serial driver
+
+void soft_serial_initiator_init(void) {
+    split_sim_master_initiator_init();
+}
+
+void soft_serial_target_init(void) {
+    split_sim_slave_target_init();
+}
+
+bool soft_serial_transaction(int index) {
+    if (index < 0 || index >= NUM_TOTAL_TRANSACTIONS) {
+        return false;
+    }
+
+    current_stats = &stats.transactions[index];
+    current_stats->count++;
+    bool okay = split_sim_master_transaction(index);
+    // The slave works through whatever is left in its receive queue, as its own thread would
+    while (slave_can_run()) {
+        run_slave();
+    }
+    if (!okay) {
+        current_stats->failures++;
+    }
+    current_stats = NULL;
+    link_flush_time();
+    return okay;
+}
+
+#if defined(SERIAL_PROTOCOL_CRC)
+const serial_protocol_stats_t *serial_protocol_get_stats(void) {
+    return split_sim_master_get_stats();
+}
+
+const serial_protocol_stats_t *split_simulator_get_slave_protocol_stats(void) {
+    return split_sim_slave_get_stats();
+}
+#endif
+
+////////////////////////////////////////////////////
+// Simulator
+
+void split_simulator_reset(void) {
+    // Both halves start the protocol over, a negotiated speed does not carry over
+    soft_serial_initiator_init();
+    soft_serial_target_init();
+    // Drop whatever the slave was in the middle of
+    if (slave_timed) {
+        slave_expired = true;
+        run_slave();
+    }
+    queue_clear(SIDE_MASTER);
+    queue_clear(SIDE_SLAVE);
+    last_sender = -1;
+
+    split_simulator_set_link(&default_link);
+    split_simulator_clear_stats();
+    memset(&slave_shmem, 0, sizeof(slave_shmem));
+    memset(slave_view, 0, sizeof(slave_view));
+    pending_us  = 0;
+    initialized = true;
+}
+
+void split_simulator_set_link(const split_sim_link_t *new_link) {
+    link     = *new_link;
+    link_rng = link.seed ? link.seed : 1;
+}
+
+split_sim_link_t split_simulator_get_link(void) {
+    return link;
+}
+
+const split_sim_stats_t *split_simulator_get_stats(void) {
+    return &stats;
+}
+
+void split_simulator_clear_stats(void) {
+    memset(&stats, 0, sizeof(stats));
+}
+
+const split_shared_memory_t *split_simulator_get_slave_shmem(void) {
+    return &slave_shmem;
+}
+
+void split_simulator_scan(const matrix_row_t physical[], matrix_row_t view[]) {
+    if (!initialized) {
+        split_simulator_reset();
+    }
+
+    // One slave loop: the right half reads its own keys and prepares its side of the transactions
+    memcpy(slave_view + ROWS_PER_HAND, physical + ROWS_PER_HAND, sizeof(matrix_row_t) * ROWS_PER_HAND);
+    enter_slave();
+    transport_slave(slave_view, slave_view + ROWS_PER_HAND);
+    leave_slave();
+
+    // The master side of matrix_scan() in matrix_common.c
+    matrix_row_t slave_matrix[ROWS_PER_HAND] = {0};
+    memcpy(view, physical, sizeof(matrix_row_t) * ROWS_PER_HAND);
+    if (transport_master_if_connected(view, slave_matrix)) {
+        memcpy(view + ROWS_PER_HAND, slave_matrix, sizeof(slave_matrix));
+        last_connected = true;
+    } else if (last_connected) {
+        memset(view + ROWS_PER_HAND, 0, sizeof(slave_matrix));
+        last_connected = false;
+    }
+}
@@ -0,0 +1,71 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "matrix.h"
+#include "serial.h"
+#include "transaction_id_define.h"
+#include "transport.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * In-process stand-in for the split serial link. The test keyboard is the master (left) half, the
+ * slave (right) half runs the same split_common code against its own copy of the shared memory.
+ * Each half links its own copy of `serial_protocol.c`, talking to the other over a simulated
+ * link. The slave protocol thread runs on a host thread that only runs while the master waits for
+ * it, so the halves take turns and every run is reproducible.
+ *
+ * Time spent on the link is added to the test clock.
+ */
+
+typedef struct split_sim_link_t {
+    uint32_t bit_rate;       // bits per second at SERIAL_USART_SPEED, every byte takes 10 bits on the wire
+    uint32_t max_bit_rate;   // bytes sent faster than this are garbled, 0 for no limit
+    uint32_t latency_us;     // added every time the line changes direction
+    uint32_t timeout_us;     // how long a side waits for a byte that never arrives
+    float    bit_error_rate; // probability of each bit being flipped
+    float    drop_rate;      // probability of each byte being lost
+    uint32_t seed;           // seed of the error generator, runs are reproducible
+} split_sim_link_t;
+
+typedef struct split_sim_transaction_stats_t {
+    uint32_t count;
+    uint32_t failures;
+    uint32_t bytes_to_slave;
+    uint32_t bytes_to_master;
+    uint32_t time_us;
+} split_sim_transaction_stats_t;
+
+typedef struct split_sim_stats_t {
+    split_sim_transaction_stats_t transactions[NUM_TOTAL_TRANSACTIONS];
+    uint32_t                      corrupted_bytes;
+    uint32_t                      dropped_bytes;
+    uint32_t                      link_time_us;
+} split_sim_stats_t;
+
+// Resets the link to a clean 1 Mbit/s connection, the protocol of both halves, the slave state and the statistics
+void                     split_simulator_reset(void);
+void                     split_simulator_set_link(const split_sim_link_t *link);
+split_sim_link_t         split_simulator_get_link(void);
+const split_sim_stats_t *split_simulator_get_stats(void);
+void                     split_simulator_clear_stats(void);
+// The shared memory as the slave last left it
+const split_shared_memory_t *split_simulator_get_slave_shmem(void);
+#if defined(SERIAL_PROTOCOL_CRC)
+// Protocol statistics as counted by the slave, serial_protocol_get_stats() returns the master's
+const serial_protocol_stats_t *split_simulator_get_slave_protocol_stats(void);
+#endif
+
+// Runs one slave loop and one master transport cycle. `physical` holds the keys pressed on
+// both halves, `view` receives the matrix as the master sees it.
+void split_simulator_scan(const matrix_row_t physical[], matrix_row_t view[]);
+
+#ifdef __cplusplus
+}
+#endif
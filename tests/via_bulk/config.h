@@ -0,0 +1,10 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define VIA_BULK_TRANSFER_ENABLE
+
+#define TRANSIENT_EEPROM_SIZE 1024
@@ -0,0 +1,179 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <vector>
+#include "test_common.hpp"
+
+extern "C" {
+#include "via.h"
+#include "raw_hid.h"
+#include "dynamic_keymap.h"
+#include "crc.h"
+}
+
+#define PACKET_SIZE 32
+#define CHUNK_SIZE (PACKET_SIZE - 5)
+#define KEYMAP_SIZE (DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2)
+
+typedef std::array<uint8_t, PACKET_SIZE> packet_t;
+
+static std::vector<packet_t> sent;
+
+extern "C" void raw_hid_send(uint8_t *data, uint8_t length) {
+    packet_t packet = {};
+    memcpy(packet.data(), data, length);
+    sent.push_back(packet);
+}
+
+class ViaBulk : public TestFixture {
+   public:
+    void SetUp() override {
+        sent.clear();
+        dynamic_keymap_reset();
+        for (uint16_t i = 0; i < KEYMAP_SIZE; i++) {
+            keymap[i] = (uint8_t)(i * 7 + 3);
+        }
+        dynamic_keymap_set_buffer(0, KEYMAP_SIZE, keymap);
+    }
+
+    /* Sends one command the way the host does, and returns every packet sent back */
+    std::vector<packet_t> command(std::initializer_list<uint8_t> bytes) {
+        packet_t packet = {};
+        std::copy(bytes.begin(), bytes.end(), packet.begin());
+        sent.clear();
+        raw_hid_receive(packet.data(), PACKET_SIZE);
+        return sent;
+    }
+
+    std::vector<packet_t> bulk_read(uint8_t region, uint16_t offset, uint16_t size) {
+        return command({id_bulk_read, region, (uint8_t)(offset >> 8), (uint8_t)offset, (uint8_t)(size >> 8), (uint8_t)size});
+    }
+
+    uint16_t generation(void) {
+        auto reply = command({id_bulk_get_generation});
+        EXPECT_EQ(reply.size(), 1);
+        return (reply[0][1] << 8) | reply[0][2];
+    }
+
+    /* Checks the data packets of a read against the keymap, and that the trailer closes it */
+    void expect_keymap_read(const std::vector<packet_t> &packets, uint16_t offset, uint16_t end) {
+        ASSERT_EQ(packets.size(), (end - offset + CHUNK_SIZE - 1) / CHUNK_SIZE + 1);
+        uint16_t crc = 0xFFFF;
+        for (size_t i = 0; i + 1 < packets.size(); i++) {
+            const packet_t &packet = packets[i];
+            uint8_t         count  = MIN(CHUNK_SIZE, end - offset);
+            EXPECT_EQ(packet[0], id_bulk_read);
+            EXPECT_EQ(packet[1], id_bulk_region_keymap);
+            EXPECT_EQ((packet[2] << 8) | packet[3], offset);
+            EXPECT_EQ(packet[4], count);
+            EXPECT_EQ(memcmp(&packet[5], &keymap[offset], count), 0) << "packet " << i;
+            for (uint8_t j = 5 + count; j < PACKET_SIZE; j++) {
+                EXPECT_EQ(packet[j], 0) << "padding of packet " << i;
+            }
+            crc = crc16_update(crc, &packet[5], count);
+            offset += count;
+        }
+
+        const packet_t &trailer = packets.back();
+        EXPECT_EQ((trailer[2] << 8) | trailer[3], end);
+        EXPECT_EQ(trailer[4], 0);
+        EXPECT_EQ((trailer[5] << 8) | trailer[6], crc);
+        EXPECT_EQ((trailer[7] << 8) | trailer[8], dynamic_keymap_get_generation());
+    }
+
+    uint8_t keymap[KEYMAP_SIZE];
+};
+
+TEST_F(ViaBulk, WholeRegion) {
+    auto packets = bulk_read(id_bulk_region_keymap, 0, 0xFFFF);
+    expect_keymap_read(packets, 0, KEYMAP_SIZE);
+    EXPECT_EQ((packets.back()[5] << 8) | packets.back()[6], crc16(keymap, KEYMAP_SIZE));
+}
+
+TEST_F(ViaBulk, ReadAcrossChunkBoundaries) {
+    /* Starts mid chunk, crosses two boundaries and ends in a partial packet */
+    expect_keymap_read(bulk_read(id_bulk_region_keymap, 20, 60), 20, 80);
+}
+
+TEST_F(ViaBulk, ReadOfExactlyOneChunk) {
+    expect_keymap_read(bulk_read(id_bulk_region_keymap, CHUNK_SIZE, CHUNK_SIZE), CHUNK_SIZE, 2 * CHUNK_SIZE);
+}
+
+TEST_F(ViaBulk, ReadIsClampedToTheRegion) {
+    expect_keymap_read(bulk_read(id_bulk_region_keymap, KEYMAP_SIZE - 10, 100), KEYMAP_SIZE - 10, KEYMAP_SIZE);
+}
+
+TEST_F(ViaBulk, ReadPastTheRegionOnlySendsTheTrailer) {
+    auto packets = bulk_read(id_bulk_region_keymap, KEYMAP_SIZE, 10);
+    ASSERT_EQ(packets.size(), 1);
+    EXPECT_EQ((packets[0][2] << 8) | packets[0][3], KEYMAP_SIZE);
+    EXPECT_EQ(packets[0][4], 0);
+    EXPECT_EQ((packets[0][5] << 8) | packets[0][6], 0xFFFF);
+}
+
+TEST_F(ViaBulk, ResumedReadMatchesOneRead) {
+    auto first = bulk_read(id_bulk_region_keymap, 0, 3 * CHUNK_SIZE);
+    expect_keymap_read(first, 0, 3 * CHUNK_SIZE);
+    expect_keymap_read(bulk_read(id_bulk_region_keymap, 3 * CHUNK_SIZE, 0xFFFF), 3 * CHUNK_SIZE, KEYMAP_SIZE);
+}
+
+TEST_F(ViaBulk, UnknownRegionIsUnhandled) {
+    auto packets = bulk_read(0x7F, 0, 10);
+    ASSERT_EQ(packets.size(), 1);
+    EXPECT_EQ(packets[0][0], id_unhandled);
+}
+
+TEST_F(ViaBulk, ReadAfterKeymapWrite) {
+    /* Layer 1, row 2, column 3 */
+    command({id_dynamic_keymap_set_keycode, 1, 2, 3, 0x12, 0x34});
+    uint16_t offset    = ((1 * MATRIX_ROWS + 2) * MATRIX_COLS + 3) * 2;
+    keymap[offset]     = 0x12;
+    keymap[offset + 1] = 0x34;
+
+    expect_keymap_read(bulk_read(id_bulk_region_keymap, 0, 0xFFFF), 0, KEYMAP_SIZE);
+}
+
+TEST_F(ViaBulk, ReadAfterBufferWrite) {
+    /* A VIA buffer write straddling the second chunk boundary */
+    uint8_t data[] = {0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5};
+    command({id_dynamic_keymap_set_buffer, 0, 2 * CHUNK_SIZE - 3, sizeof(data), 0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5});
+    memcpy(&keymap[2 * CHUNK_SIZE - 3], data, sizeof(data));
+
+    expect_keymap_read(bulk_read(id_bulk_region_keymap, CHUNK_SIZE, 2 * CHUNK_SIZE), CHUNK_SIZE, 3 * CHUNK_SIZE);
+}
+
+TEST_F(ViaBulk, GenerationBumpsOnEveryChange) {
+    uint16_t before = generation();
+    EXPECT_EQ(before, dynamic_keymap_get_generation());
+
+    command({id_dynamic_keymap_set_keycode, 0, 0, 0, 0x00, 0x04});
+    EXPECT_EQ(generation(), (uint16_t)(before + 1));
+
+    command({id_dynamic_keymap_set_buffer, 0, 0, 2, 0x00, 0x05});
+    EXPECT_EQ(generation(), (uint16_t)(before + 2));
+
+    command({id_dynamic_keymap_macro_set_buffer, 0, 0, 2, 'a', 0});
+    EXPECT_EQ(generation(), (uint16_t)(before + 3));
+
+    command({id_dynamic_keymap_reset});
+    EXPECT_EQ(generation(), (uint16_t)(before + 4));
+
+    command({id_dynamic_keymap_macro_reset});
+    EXPECT_EQ(generation(), (uint16_t)(before + 5));
+}
+
+TEST_F(ViaBulk, ReadsDoNotBumpTheGeneration) {
+    uint16_t before = generation();
+    bulk_read(id_bulk_region_keymap, 0, 0xFFFF);
+    bulk_read(id_bulk_region_macros, 0, 0xFFFF);
+    command({id_dynamic_keymap_get_buffer, 0, 0, 28});
+    EXPECT_EQ(generation(), before);
+}
+
+TEST_F(ViaBulk, TrailerCarriesTheGenerationAfterAWrite) {
+    auto before = bulk_read(id_bulk_region_keymap, 0, 4).back();
+    command({id_dynamic_keymap_set_keycode, 0, 0, 1, 0x00, 0x04});
+    auto after = bulk_read(id_bulk_region_keymap, 0, 4).back();
+    EXPECT_EQ((uint16_t)((after[7] << 8) | after[8]), (uint16_t)(((before[7] << 8) | before[8]) + 1));
+}
@@ -128,6 +128,66 @@ void boardInit(void) {
     board_init();
 }
 
+#ifdef MATRIX_SCAN_THREAD
+#    include "matrix.h"
+
+#    ifndef MATRIX_SCAN_THREAD_INTERVAL_US
+#        define MATRIX_SCAN_THREAD_INTERVAL_US 125
+#    endif
+#    ifndef MATRIX_SCAN_THREAD_MIN_SLEEP_US
+#        define MATRIX_SCAN_THREAD_MIN_SLEEP_US 100
+#    endif
+#    ifndef MATRIX_SCAN_THREAD_PRIORITY
+#        define MATRIX_SCAN_THREAD_PRIORITY (NORMALPRIO + 8)
+#    endif
+
+#    if MATRIX_SCAN_THREAD_MIN_SLEEP_US <= 0
+#        error "MATRIX_SCAN_THREAD_MIN_SLEEP_US must be positive, otherwise the scan thread can starve the main loop"
+#    endif
+
+// Serialises the scan thread with the wakeup scans of the main loop while suspended
+static MUTEX_DECL(matrix_scan_mutex);
+
+/* Scans the matrix at a fixed rate, above the priority of the main loop.
+ * Changes are handed over through the key event queue and processed by
+ * keyboard_task(). The effective rate is bounded by CH_CFG_ST_FREQUENCY.
+ */
+static THD_WORKING_AREA(waMatrixScanThread, 512);
+static THD_FUNCTION(MatrixScanThread, arg) {
+    (void)arg;
+    chRegSetThreadName("matrix_scan");
+
+    systime_t next = chVTGetSystemTime();
+    while (true) {
+        // Sleep at least the minimum every time: a scan that overruns the interval
+        // restarts the schedule from now instead of catching up back to back
+        systime_t now      = chVTGetSystemTime();
+        next               = chTimeAddX(next, TIME_US2I(MATRIX_SCAN_THREAD_INTERVAL_US));
+        sysinterval_t wait = chTimeDiffX(now, next);
+        if (wait < TIME_US2I(MATRIX_SCAN_THREAD_MIN_SLEEP_US) || wait > TIME_US2I(MATRIX_SCAN_THREAD_INTERVAL_US)) {
+            next = chTimeAddX(now, TIME_US2I(MATRIX_SCAN_THREAD_MIN_SLEEP_US));
+        }
+        chThdSleepUntil(next);
+
+        // The main loop scans on its own to detect wakeup while suspended
+        if (USB_DRIVER.state != USB_SUSPENDED && matrix_can_read()) {
+            chMtxLock(&matrix_scan_mutex);
+            matrix_scan_task();
+            chMtxUnlock(&matrix_scan_mutex);
+        }
+    }
+}
+
+static inline bool protocol_suspend_wakeup_condition(void) {
+    chMtxLock(&matrix_scan_mutex);
+    bool wakeup = suspend_wakeup_condition();
+    chMtxUnlock(&matrix_scan_mutex);
+    return wakeup;
+}
+#else
+#    define protocol_suspend_wakeup_condition() suspend_wakeup_condition()
+#endif
+
 void protocol_setup(void) {
     usb_device_state_init();
 
@@ -172,6 +232,10 @@ void protocol_pre_init(void) {
 
 void protocol_post_init(void) {
     host_set_driver(driver);
+
+#ifdef MATRIX_SCAN_THREAD
+    chThdCreateStatic(waMatrixScanThread, sizeof(waMatrixScanThread), MATRIX_SCAN_THREAD_PRIORITY, MatrixScanThread, NULL);
+#endif
 }
 
 void protocol_pre_task(void) {
@@ -184,7 +248,7 @@ void protocol_pre_task(void) {
             /* Do this in the suspended state */
             suspend_power_down(); // on AVR this deep sleeps for 15ms
             /* Remote wakeup */
-            if ((USB_DRIVER.status & USB_GETSTATUS_REMOTE_WAKEUP_ENABLED) && suspend_wakeup_condition()) {
+            if ((USB_DRIVER.status & USB_GETSTATUS_REMOTE_WAKEUP_ENABLED) && protocol_suspend_wakeup_condition()) {
                 usbWakeupHost(&USB_DRIVER);
 #    if USB_SUSPEND_WAKEUP_DELAY > 0
                 // Some hubs, kvm switches, and monitors do